@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+Turns the ASSETS/DATA atlas text files into include/AssetTables.h, constexpr arrays indexed
+by the matching enum so the game can look rects up by type instead of parsing text.
+
+Run from the project folder (Thorns/Thorns) after editing any of the DATA files:
+    python Tools/generate_asset_tables.py
+
+Debug builds still parse the text files and warn when they no longer match the header.
+"""
+import os
+import sys
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DATA_DIR = os.path.join(PROJECT_DIR, "ASSETS", "DATA")
+OUTPUT = os.path.join(PROJECT_DIR, "include", "AssetTables.h")
+
+# (array name, data file, enum it is indexed by, [(enum value, key in the file)] in enum order)
+TABLES = [
+    ("ITEM_ATLAS", "items_atlas.txt", "ItemType", [
+        ("Food", "food-tin"),
+        ("Water", "water-bottle"),
+        ("FirstAid", "medkit"),
+        ("Bandage", "bandage"),
+        ("Knife", "knife"),
+        ("Axe", "fire-axe"),
+        ("Gun", "pistol"),
+    ]),
+    ("FOREST_ATLAS", "forest-atlas-points.txt", "WorldObject::Type", [
+        ("SmallRoot", "SmallRoot"),
+        ("TreeTop1", "TreeTop_1"),
+        ("TreeTop2", "TreeTop_2"),
+        ("LargeRoot", "LargeRoot"),
+        ("SmallRootBasic", "SmallRoot_Basic"),
+    ]),
+]
+
+
+def read_rects(path):
+    """name,x,y,width,height per line -> {name: (x, y, w, h)}"""
+    rects = {}
+    with open(path, "r", encoding="utf-8-sig") as file:
+        for number, line in enumerate(file, 1):
+            line = line.strip()
+            if not line:
+                continue
+            parts = [part.strip() for part in line.split(",")]
+            if len(parts) != 5:
+                sys.exit("%s:%d: expected name,x,y,width,height" % (path, number))
+            rects[parts[0]] = tuple(int(value) for value in parts[1:])
+    return rects
+
+
+def main():
+    lines = [
+        "// ========================================================================================================",
+        "// GENERATED by Tools/generate_asset_tables.py from ASSETS/DATA, edit the text files and rerun it",
+        "// ========================================================================================================",
+        "#ifndef ASSET_TABLES_H",
+        "#define ASSET_TABLES_H",
+        "",
+        "namespace AssetTables",
+        "{",
+        "    struct AtlasEntry",
+        "    {",
+        "        const char* key;    // Name column in the data file",
+        "        int x, y, width, height;",
+        "    };",
+    ]
+
+    for name, data_file, enum_name, entries in TABLES:
+        rects = read_rects(os.path.join(DATA_DIR, data_file))
+        lines.append("")
+        lines.append("    // %s, indexed by %s" % (data_file, enum_name))
+        lines.append("    inline constexpr AtlasEntry %s[] =" % name)
+        lines.append("    {")
+        for enum_value, key in entries:
+            if key not in rects:
+                sys.exit("%s has no entry for '%s' (%s::%s)" % (data_file, key, enum_name, enum_value))
+            x, y, w, h = rects[key]
+            entry = '{ "%s", %d, %d, %d, %d },' % (key, x, y, w, h)
+            lines.append("        %-48s // %s" % (entry, enum_value))
+        lines.append("    };")
+
+    lines += ["}", "", "#endif", ""]
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\r\n") as out:
+        out.write("\n".join(lines))
+
+    print("Wrote %s" % OUTPUT)
+
+
+if __name__ == "__main__":
+    main()
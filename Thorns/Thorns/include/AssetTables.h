@@ -0,0 +1,38 @@
+// ========================================================================================================
+// GENERATED by Tools/generate_asset_tables.py from ASSETS/DATA, edit the text files and rerun it
+// ========================================================================================================
+#ifndef ASSET_TABLES_H
+#define ASSET_TABLES_H
+
+namespace AssetTables
+{
+    struct AtlasEntry
+    {
+        const char* key;    // Name column in the data file
+        int x, y, width, height;
+    };
+
+    // items_atlas.txt, indexed by ItemType
+    inline constexpr AtlasEntry ITEM_ATLAS[] =
+    {
+        { "food-tin", 65, 0, 64, 64 },                   // Food
+        { "water-bottle", 65, 65, 64, 64 },              // Water
+        { "medkit", 0, 130, 64, 64 },                    // FirstAid
+        { "bandage", 65, 130, 64, 64 },                  // Bandage
+        { "knife", 130, 0, 64, 64 },                     // Knife
+        { "fire-axe", 0, 65, 64, 64 },                   // Axe
+        { "pistol", 0, 0, 64, 64 },                      // Gun
+    };
+
+    // forest-atlas-points.txt, indexed by WorldObject::Type
+    inline constexpr AtlasEntry FOREST_ATLAS[] =
+    {
+        { "SmallRoot", 669, 500, 272, 281 },             // SmallRoot
+        { "TreeTop_1", 0, 0, 481, 499 },                 // TreeTop1
+        { "TreeTop_2", 482, 0, 481, 499 },               // TreeTop2
+        { "LargeRoot", 0, 500, 668, 888 },               // LargeRoot
+        { "SmallRoot_Basic", 669, 782, 122, 122 },       // SmallRootBasic
+    };
+}
+
+#endif
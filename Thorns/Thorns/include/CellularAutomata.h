@@ -0,0 +1,90 @@
+#ifndef CELLULAR_AUTOMATA_HPP
+#define CELLULAR_AUTOMATA_HPP
+
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Bit-packed 2D cellular automaton for the Phase 3 map refinement
+///
+/// Each row is stored as 64-bit words, bit i of word k is cell (k * 64 + i).
+/// A step works on a whole word at once:
+/// - The 8 neighbours of all 64 cells are the row above/same/below shifted one bit left and right
+///   (carrying the edge bit in from the next word)
+/// - Those 8 one-bit planes go through a full adder tree to give a 4-bit count per cell
+/// - Birth/survival masks are applied to the count planes with plain AND/OR
+///
+/// Grids are double buffered so rows can be split into bands and stepped as JobSystem jobs.
+/// Cells outside the map count as dead. Cells cleared in the lock mask are forced dead every step
+/// (POIs, site clearings), so nothing grows into them.
+/// </summary>
+class CellularAutomata
+{
+public:
+    // Life-like rule, bit n set = n live neighbours triggers it (n = 0..8)
+    struct Rules
+    {
+        std::uint16_t birthMask = 0;     // Dead cell becomes alive
+        std::uint16_t survivalMask = 0;  // Live cell stays alive
+    };
+
+    CellularAutomata();
+    ~CellularAutomata() = default;
+
+    // ========== Setup ==========
+    // Reallocates only when the size changes, all cells dead and unlocked afterwards
+    void resize(int width, int height);
+    void clear();
+
+    void setCell(int x, int y, bool alive);
+    bool getCell(int x, int y) const;
+
+    // Locked cells are dead and stay dead
+    void setLocked(int x, int y, bool locked);
+
+    // ========== Simulation ==========
+    // One generation. threadCount caps the bands, 0 = every JobSystem thread, small grids always run on one thread
+    void step(const Rules& rules, unsigned int threadCount = 0);
+
+    // Runs iterations generations back to back
+    void run(const Rules& rules, int iterations, unsigned int threadCount = 0);
+
+    // ========== Queries ==========
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    int countAlive() const;
+
+    // Builds a mask from "B5678" style digit lists
+    static std::uint16_t makeMask(const char* digits);
+
+private:
+    // Steps rows [rowBegin, rowEnd) from m_front into m_back
+    void stepRows(const Rules& rules, int rowBegin, int rowEnd);
+
+    int m_width;
+    int m_height;
+    int m_wordsPerRow;
+    std::uint64_t m_lastWordMask;    // Keeps the padding bits past the map edge at 0
+
+    std::vector<std::uint64_t> m_front;   // Current generation
+    std::vector<std::uint64_t> m_back;    // Next generation, swapped after each step
+    std::vector<std::uint64_t> m_open;    // 1 = cell may be alive (inverse of locked)
+
+    // Below this many words a step is cheaper than queuing a band
+    static constexpr int MIN_WORDS_PER_BAND = 4096;
+};
+
+#endif
+
+// Personal Notes Cellular Automata:
+/*
+ * Neighbour count with bitwise adders, per 64 cell word:
+ *   n0..n7 = the eight neighbour planes (NW, N, NE, W, E, SW, S, SE)
+ *   Full adder: sum = a ^ b ^ c, carry = (a & b) | (c & (a ^ b))
+ *   3 adders reduce the 8 planes to a ones bit plus 4 carries of weight 2,
+ *   2 more levels fold those into the twos, fours and eights planes.
+ *   Count n is then just the AND of the 4 planes (or their inverse) that spell n in binary.
+ *
+ * Default rules (B5678/S45678) are the standard "cave" rules, random fill around 40-45%
+ * settles into smooth blobs in 4-5 generations.
+ */
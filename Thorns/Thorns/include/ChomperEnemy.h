@@ -1,7 +1,7 @@
 #ifndef CHOMPER_ENEMY_H
 #define CHOMPER_ENEMY_H
 
-#include "SpriteComponent.h"
+#include "SpriteView.h"
 #include "IEnemy.h"
 #include <SFML/System/Time.hpp>
 
@@ -33,7 +33,8 @@ public:
 
     // ========== Initialization ==========
     // atlasPath: shared sprite sheet for the chomper
-    bool initialize(const std::string& atlasPath);
+    // Atlas is owned by EnemyManager, shared by every pool slot
+    bool initialize(const sf::Texture& atlas);
 
     // ========== IUpdatable ==========
     void update(sf::Time deltaTime) override;
@@ -63,6 +64,7 @@ public:
     // ========== Queries ==========
     AIState getAIState() const { return m_aiState; }
     bool isLeaping()     const { return m_aiState == AIState::Leap; }
+    const SpriteView& getSpriteView() const { return m_sprite; }
 
     void takeDamage(float amount);
 
@@ -72,7 +74,7 @@ private:
     void faceDirection(const sf::Vector2f& direction);
     void beginLeap(const sf::Vector2f& targetPos);
 
-    SpriteComponent m_sprite;
+    SpriteView m_sprite;
     bool m_active;
 
     AIState m_aiState;
@@ -100,4 +102,4 @@ private:
     static constexpr float SPRITE_NORTH_OFFSET = 90.f;
 };
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -25,6 +25,7 @@ public:
         bool collided;
         sf::Vector2f penetration;
         const ICollidable* collidedWith;
+        const WorldObject* collidedObject = nullptr;  // Set instead of collidedWith for world objects
     };
 
     // Check if entity collides with any world object
@@ -40,7 +41,7 @@ public:
         const std::vector<std::unique_ptr<T>>& objects) const;
 
     CollisionResult checkCollisionWith(const sf::FloatRect& entityBounds,
-        const std::vector<std::unique_ptr<WorldObject>>& objects) const;
+        const std::vector<WorldObject>& objects) const;
 
     // Resolve collision by calculating correction vector
     sf::Vector2f resolveCollision(const CollisionResult& collision) const;
@@ -49,6 +50,12 @@ public:
     static bool aabbVsPolygon(const sf::FloatRect& box, const std::vector<sf::Vector2f>& points);
 
 private:
+    // Objects per job when sweeping the world object list, lists this short stay on the calling thread
+    static constexpr int OBJECTS_PER_JOB = 1024;
+
+    // Broad + narrow phase against one world object, fills result on a hit
+    bool testObject(const sf::FloatRect& entityBounds, const WorldObject& obj, CollisionResult& result) const;
+
     // Calculate minimum translation vector to separate two rectangles
     sf::Vector2f getMinimumTranslationVector(const sf::FloatRect& a, const sf::FloatRect& b) const;
 
@@ -0,0 +1,84 @@
+#ifndef COLLISION_TEMPLATE_CACHE_H
+#define COLLISION_TEMPLATE_CACHE_H
+
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CollisionType.h"
+
+/// <summary>
+/// Binary cache of the collision shapes pulled out of a TMX template, so the XML only gets
+/// parsed the first time (or after the .tmx is edited in Tiled).
+///
+/// File layout (little endian, one file per .tmx under cache/templates):
+///   Header    { magic "THCT", version, group/shape/point counts }
+///   groups    [n] GroupRecord   one per template (POI) or object type (world objects)
+///   shapes    [n] ShapeRecord   rect or polygon, AABB precomputed
+///   points    [n] PointRecord   polygon points, shapes index into this
+///
+/// The file is memory mapped and the shape vectors are filled straight from the records,
+/// no text parsing. A cache older than its .tmx is ignored and rewritten.
+/// </summary>
+class CollisionTemplateCache
+{
+public:
+    static constexpr std::uint32_t FILE_MAGIC = 0x54434854;    // "THCT"
+    static constexpr std::uint32_t FILE_VERSION = 2;    // 2: world object groups keyed by TMX name, not type
+
+    // One template worth of shapes. name is the key for world objects (the TMX object name),
+    // id is free for the owner
+    struct Group
+    {
+        std::string name;
+        std::int32_t id = 0;
+        sf::Vector2f size;
+        std::vector<CollisionShape> shapes;
+    };
+
+    // ========== Records ==========
+    struct Header
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t groupCount;
+        std::uint32_t shapeCount;
+        std::uint32_t pointCount;
+        std::uint32_t reserved;
+    };
+
+    struct GroupRecord
+    {
+        char name[32];
+        std::int32_t id;
+        float sizeX, sizeY;
+        std::uint32_t firstShape;
+        std::uint32_t shapeCount;
+    };
+
+    struct ShapeRecord
+    {
+        std::uint8_t kind;          // 0 = rect, 1 = polygon
+        std::uint8_t padding[3];
+        std::uint32_t firstPoint;
+        std::uint32_t pointCount;
+        float left, top, width, height;     // Rect itself, or the polygon's AABB
+    };
+
+    struct PointRecord
+    {
+        float x, y;
+    };
+
+    // ========== Load / Save ==========
+    // False when there is no cache, it's older than the .tmx, or it fails validation
+    static bool load(const std::string& tmxPath, std::vector<Group>& outGroups);
+    static bool save(const std::string& tmxPath, const std::vector<Group>& groups);
+
+    static std::string cachePathFor(const std::string& tmxPath);
+
+private:
+    static bool isStale(const std::string& tmxPath, const std::string& cachePath);
+};
+
+#endif
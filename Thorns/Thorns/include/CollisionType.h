@@ -2,13 +2,42 @@
 #define COLLISION_TYPES_H
 
 #include <SFML/Graphics.hpp>
+#include <algorithm>
 #include <vector>
 #include <variant>
 
 // Convex polygon defined by a list of points in local or world space
+// Bounds is the AABB of the points, worked out once at load so narrow phase can reject early.
+// Anything that moves the points has to move the bounds with them
 struct CollisionPolygon
 {
     std::vector<sf::Vector2f> points;
+    sf::FloatRect bounds;
+
+    void computeBounds()
+    {
+        if (points.empty())
+        {
+            bounds = sf::FloatRect();
+            return;
+        }
+
+        sf::Vector2f min = points[0];
+        sf::Vector2f max = points[0];
+        for (const auto& pt : points)
+        {
+            min.x = std::min(min.x, pt.x); max.x = std::max(max.x, pt.x);
+            min.y = std::min(min.y, pt.y); max.y = std::max(max.y, pt.y);
+        }
+        bounds = sf::FloatRect(min, max - min);
+    }
+
+    void translate(const sf::Vector2f& offset)
+    {
+        for (auto& pt : points)
+            pt += offset;
+        bounds.position += offset;
+    }
 };
 
 // Circle Collision
@@ -19,4 +48,4 @@ struct CircleShape
 
 using CollisionShape = std::variant<sf::FloatRect, CollisionPolygon>;
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef CONNECTIVITY_MAP_HPP
+#define CONNECTIVITY_MAP_HPP
+
+#include <SFML/System/Vector2.hpp>
+#include <vector>
+
+class Map;
+
+/// <summary>
+/// Phase 4 connectivity validation and repair, every step is linear in the tile count
+///
+/// 1) labelComponents: scanline union-find over walkable runs (4-connected), one sweep plus
+///    a flatten pass. Gives every walkable tile a component id
+/// 2) connectTargets: 0-1 BFS out of the source component, walkable tiles cost 0 and carvable
+///    (blocked, non POI) tiles cost 1. Each unreachable target walks its parent chain back,
+///    carving only the blocked tiles on it, so every corridor is the fewest tiles possible
+/// 3) buildDistanceField: plain BFS from the source over the repaired map, kept for later use
+///    (AI, spawn placement, loot tiers by distance from home)
+///
+/// Buffers are kept between regenerations, after the first map nothing here allocates.
+/// </summary>
+class ConnectivityMap
+{
+public:
+    struct Report
+    {
+        int componentCount = 0;      // Walkable components before repair
+        int targetsChecked = 0;
+        int targetsUnreachable = 0;  // Before repair
+        int targetsSkipped = 0;      // Target tile can't be walked or carved (inside a POI wall)
+        int tilesCarved = 0;
+    };
+
+    ConnectivityMap();
+    ~ConnectivityMap() = default;
+
+    // ========== Phases ==========
+    // Returns the number of components
+    int labelComponents(const Map& map);
+
+    // Joins every target to the source's component. labelComponents() must have run first
+    Report connectTargets(Map& map, const sf::Vector2i& source, const std::vector<sf::Vector2i>& targets);
+
+    // Walking distance in tiles from source, -1 where unreachable
+    void buildDistanceField(const Map& map, const sf::Vector2i& source);
+
+    // ========== Queries ==========
+    int getComponent(int x, int y) const;   // -1 for blocked tiles, carved tiles join the source component
+    int getDistance(int x, int y) const;    // -1 for unreachable tiles
+    int getComponentCount() const { return m_componentCount; }
+    const std::vector<int>& getDistanceField() const { return m_distance; }
+
+private:
+    int index(int x, int y) const { return y * m_width + x; }
+    bool inBounds(int x, int y) const { return x >= 0 && y >= 0 && x < m_width && y < m_height; }
+
+    // ========== Union-Find ==========
+    int findRoot(int label);
+    void unite(int a, int b);
+
+    int m_width;
+    int m_height;
+    int m_componentCount;
+
+    std::vector<int> m_labels;      // Component per tile, -1 = blocked
+    std::vector<int> m_parent;      // Union-find forest over provisional run labels
+    std::vector<int> m_distance;    // Distance field from the source
+    std::vector<int> m_cost;        // 0-1 BFS carve cost
+    std::vector<int> m_cameFrom;    // 0-1 BFS parent tile
+    std::vector<int> m_queue;       // Ring deque storage for both BFS passes
+    std::vector<char> m_joined;     // Per component, already connected to the source
+    std::vector<int> m_crossed;     // Components a corridor walk passed through
+
+    static constexpr int UNREACHABLE = -1;
+};
+
+#endif
+
+// Personal Notes Connectivity:
+/*
+ * Scanline union-find:
+ *   Each row is split into runs of walkable tiles, every run gets a new provisional label.
+ *   A run is united with every labelled tile directly above it, which is the only place a
+ *   4-connected neighbour with a label can be. Second pass maps each root to 0..N-1.
+ *
+ * 0-1 BFS:
+ *   Deque BFS where 0 cost edges go to the front and 1 cost to the back, gives exact
+ *   shortest paths when edge weights are only 0 or 1 in O(V + E).
+ */
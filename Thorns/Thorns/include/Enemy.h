@@ -1,7 +1,7 @@
 #ifndef ENEMY_HPP
 #define ENEMY_HPP
 
-#include "SpriteComponent.h"
+#include "SpriteView.h"
 #include <SFML/System/Time.hpp>
 
 class Enemy
@@ -10,8 +10,8 @@ public:
     Enemy();
     ~Enemy() = default;
 
-    // Initialization
-    bool initialize(const std::string& texturePath);
+    // Initialization, texture is owned by the caller
+    bool initialize(const sf::Texture& texture);
 
     // IUpdatable interface
     void update(sf::Time deltaTime);
@@ -35,7 +35,7 @@ public:
 
 private:
     // Components
-    SpriteComponent m_sprite;
+    SpriteView m_sprite;
 
     // Enemy state
     float m_speed;
@@ -4,6 +4,7 @@
 #define ENEMY_MANAGER_H
 
 #include <array>
+#include <vector>
 #include <SFML/Graphics.hpp>
 #include <SFML/System/Time.hpp>
 #include "SavageEnemy.h"
@@ -25,6 +26,9 @@ public:
     static constexpr int MAX_SAVAGE = 8;
     static constexpr int MAX_CHOMPER = 8;
 
+    // Pool slots per AI job, LOS rays make each enemy worth a job of its own
+    static constexpr int ENEMIES_PER_JOB = 1;
+
     EnemyManager();
     ~EnemyManager() = default;
 
@@ -53,6 +57,19 @@ public:
 
     void renderAll(sf::RenderTarget& target) const;
 
+    // Appends a copy of every active enemy's sprite, for the threaded render snapshot
+    void captureSprites(std::vector<sf::Sprite>& out) const;
+
+    // ========== Render Interpolation ==========
+    // Snapshot positions at the start of a tick so render can blend previous -> current.
+    // Also call after spawning/teleporting so nothing slides across the map for a frame.
+    void storePreviousPositions();
+
+    // Moves every active enemy to its blended position for drawing,
+    // restoreTickPositions() must be called after render to put the sim state back
+    void applyInterpolation(float alpha);
+    void restoreTickPositions();
+
     // ========== Queries ==========
     int getActiveSavageCount()  const;
     int getActiveChomperCount() const;
@@ -71,10 +88,26 @@ private:
         const Map* map,
         const CollisionManager& collisionManager);
 
+    // Pool and its matching position slots, shared by both enemy types
+    template<typename TPool, typename TPositions>
+    static void interpolatePool(TPool& pool, const TPositions& previous,
+        TPositions& tickPositions, float alpha);
+
+    // One atlas per enemy type, loaded once, pool slots only hold SpriteViews into them
+    sf::Texture m_savageAtlas;
+    sf::Texture m_chomperAtlas;
+
     std::array<SavageEnemy, MAX_SAVAGE>  m_savagePool;
     std::array<ChomperEnemy, MAX_CHOMPER> m_chomperPool;
 
+    // ========== Interpolation State ==========
+    // Index matches the pool slot
+    std::array<sf::Vector2f, MAX_SAVAGE>  m_savagePrevPos{};
+    std::array<sf::Vector2f, MAX_SAVAGE>  m_savageTickPos{};
+    std::array<sf::Vector2f, MAX_CHOMPER> m_chomperPrevPos{};
+    std::array<sf::Vector2f, MAX_CHOMPER> m_chomperTickPos{};
+
     bool m_initialized = false;
 };
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -0,0 +1,122 @@
+#ifndef ENUM_MAP_H
+#define ENUM_MAP_H
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/// <summary>
+/// Fixed size map keyed by a dense enum class that ends in COUNT.
+///
+/// Storage is a std::array with one slot per enum value plus a bitset saying which slots have
+/// been set, so a lookup is a bounds check, a bit test and an index. No hashing, no nodes.
+/// Every registry keyed by ItemType / WorldObject::Type / PointOfInterest::Type / InputAction
+/// uses this in place of unordered_map.
+///
+/// PN: T must be default constructible, unset slots still hold a default T. Iteration only
+/// visits set slots, in enum order.
+/// </summary>
+template<typename Enum, typename T>
+class EnumMap
+{
+public:
+    static constexpr size_t CAPACITY = static_cast<size_t>(Enum::COUNT);
+
+    // ========== Iteration ==========
+    // Dereferences to (key, value&) so `for (auto [key, value] : map)` works like it did on the maps
+    template<typename Value>
+    class Iterator
+    {
+    public:
+        using Owner = std::conditional_t<std::is_const_v<Value>, const EnumMap, EnumMap>;
+
+        Iterator(Owner* owner, size_t index) : m_owner(owner), m_index(index) { skipEmpty(); }
+
+        std::pair<Enum, Value&> operator*() const
+        {
+            return { static_cast<Enum>(m_index), m_owner->m_values[m_index] };
+        }
+
+        Iterator& operator++() { ++m_index; skipEmpty(); return *this; }
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        void skipEmpty()
+        {
+            while (m_index < CAPACITY && !m_owner->m_present.test(m_index))
+                ++m_index;
+        }
+
+        Owner* m_owner;
+        size_t m_index;
+    };
+
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
+    // ========== Access ==========
+    // Inserts a default T if the key wasn't set, same as unordered_map::operator[]
+    T& operator[](Enum key)
+    {
+        const size_t index = static_cast<size_t>(key);
+        m_present.set(index);
+        return m_values[index];
+    }
+
+    void set(Enum key, const T& value) { (*this)[key] = value; }
+    void set(Enum key, T&& value) { (*this)[key] = std::move(value); }
+
+    // nullptr when the key is out of range or was never set
+    T* find(Enum key)
+    {
+        const size_t index = static_cast<size_t>(key);
+        return contains(key) ? &m_values[index] : nullptr;
+    }
+
+    const T* find(Enum key) const
+    {
+        const size_t index = static_cast<size_t>(key);
+        return contains(key) ? &m_values[index] : nullptr;
+    }
+
+    bool contains(Enum key) const
+    {
+        const size_t index = static_cast<size_t>(key);
+        return index < CAPACITY && m_present.test(index);
+    }
+
+    // ========== Modify ==========
+    void erase(Enum key)
+    {
+        const size_t index = static_cast<size_t>(key);
+        if (index >= CAPACITY)
+            return;
+
+        m_present.reset(index);
+        m_values[index] = T();
+    }
+
+    void clear()
+    {
+        m_present.reset();
+        m_values.fill(T());
+    }
+
+    // ========== Info ==========
+    size_t size() const { return m_present.count(); }
+    bool empty() const { return m_present.none(); }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, CAPACITY); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, CAPACITY); }
+
+private:
+    std::array<T, CAPACITY> m_values{};
+    std::bitset<CAPACITY> m_present;
+};
+
+#endif
@@ -12,18 +12,54 @@
 #include "IUpdatable.h"
 #include "Map.h"
 #include "MapGenerator.h"
+#include "GenerationCache.h"
 #include "CollisionManager.h"
 #include "WorldItemPool.h"
 #include "ItemType.h"
 #include "DayTimerComponent.h"
+#include "ProfilerOverlay.h"
+#include "InputRecorder.h"
+#include "RenderSnapshot.h"
+#include "SimulationWorker.h"
+#include <functional>
+#include <string>
+#include <vector>
 
 class Game : IUpdatable
 {
 public:
+    // ========== Launch Options ==========
+    // Filled from the command line in main.cpp, defaults are a normal windowed game
+    struct LaunchOptions
+    {
+        bool headless = false;              // No window, run the update loop flat out
+        unsigned int headlessTicks = 3600;  // Ticks to run before reporting (60s of game time)
+        unsigned int seed = 12345;
+        unsigned short mapWidth = 160;      // In tiles
+        unsigned short mapHeight = 160;
+        std::string recordPath;             // Record input to this file when set
+        std::string replayPath;             // Play input back from this file when set
+
+        // Frame pacing
+        unsigned int targetFps = 144;       // Render cap, 0 = uncapped
+        bool vsync = false;
+        bool interpolate = true;            // Blend entity positions between ticks when drawing
+
+        // Run the sim on a worker thread while the main thread draws the last snapshot.
+        // Only the Playing state is pipelined, menus stay serial. Ignored when headless
+        bool threadedSim = false;
+
+        // Binary map snapshots (see MapSnapshot). Loading skips generation entirely
+        std::string loadMapPath;            // Restore the map from this snapshot when set
+        std::string saveMapPath;            // Write the generated map to this snapshot when set
+        bool mapCache = true;               // Reuse maps for seeds already generated (memory + cache/maps)
+    };
+
     Game();
+    explicit Game(const LaunchOptions& options);
     ~Game();
 
-    // Main game loop - runs until window closes
+    // Main game loop - runs until window closes (or the headless tick count is reached)
     void run();
 
 private:
@@ -32,6 +68,34 @@ private:
     void update(sf::Time deltaTime) override;   // Update game logic at fixed timestep
     void render();                     // Render current game state
 
+    // ========== Fixed Tick ==========
+    // Input (live or replayed) then update, shared by the windowed and headless loops
+    void stepSimulation(sf::Time timePerFrame);
+    void runHeadless();
+    void finishRecording();
+
+    // ========== Frame Pacing ==========
+    // Max fixed ticks per rendered frame before the backlog is dropped (spiral of death guard)
+    static constexpr int MAX_UPDATES_PER_FRAME = 5;
+
+    void storePreviousPositions();            // Start of tick, interpolation source
+    void beginInterpolatedRender(float alpha); // Moves entities/camera to blended positions
+    void endInterpolatedRender();             // Puts the simulation state back
+    void limitFrameRate(sf::Clock& frameClock);
+
+    // ========== Threaded Simulation ==========
+    // Worker steps m_pendingTicks ticks then captures into the back snapshot while the main
+    // thread draws the front one. Swapped once both are done, so draws lag the sim by a frame
+    void runPipelinedFrame(int ticks, float alpha);
+    void simulationJob();                                       // Runs on the worker
+    void captureSnapshot(RenderSnapshot& snapshot, float alpha);
+    void renderSnapshot(const RenderSnapshot& snapshot);
+
+    // Anything that touches the window, the state stack or the map can't run while the
+    // worker is mid tick. Queued here and run on the main thread once it has joined
+    void runOnMainThread(std::function<void()> action);
+    bool runDeferredActions();
+
     // ========== Initialization ==========
     bool initializeGame();    // Load all resources and setup game objects
     void setupMenus();        // Configure menu items and callbacks
@@ -62,6 +126,11 @@ private:
     // ========== Map ==========
     void generateMap();         // Called during game init also
     void regenerateMap();     // Regenerate map with new seed during runtime
+    bool loadMapSnapshot(const std::string& filePath, std::vector<sf::Vector2f>& enemySpawns,
+        std::vector<sf::Vector2f>& itemSpawns);
+
+    // Despawn everything then fill the map from the given spawn points
+    void populateWorld(const std::vector<sf::Vector2f>& enemySpawns, const std::vector<sf::Vector2f>& itemSpawns);
 
     // ========== Camera ========== (might make class later PN)
     void updateCamera();
@@ -71,8 +140,12 @@ private:
     sf::Vector2f getMousePosition() const;
     sf::Vector2f getMouseWorldPosition() const;
 
+    // ========== Launch ==========
+    LaunchOptions m_options;
+    InputRecorder m_recorder;   // Replay record/playback of per tick input
+
     // ========== SFML Window ==========
-    sf::RenderWindow m_window;
+    sf::RenderWindow m_window;  // Only opened when not headless
     sf::View m_gameView;        // Game play camera
     sf::View m_uiView;          // Ui set to different view 
 
@@ -85,6 +158,7 @@ private:
     GameStateManager m_stateManager;  // Manages state transitions
     CollisionManager m_collisionManager;    // Manages Collision between objects and entities. 
     InputController m_input;          // Handles keyboard/gamepad input
+    InputFrame m_liveInput;           // Devices polled on the main thread each frame, every tick applies it
     ScreenSettings m_screenSettings;  // Manages resolution and fullscreen
 
     // ========== UI ==========
@@ -92,6 +166,7 @@ private:
     Menu m_pauseMenu;
     SettingsMenu m_settingsMenu;
     DayTimerComponent m_dayTimer;
+    ProfilerOverlay m_profilerOverlay;  // F3 to toggle, F4 captures a Chrome trace
 
     // ========== Game Objects ==========
     Player m_player;
@@ -99,9 +174,24 @@ private:
 
     // ========== World ==========
     std::unique_ptr<Map> m_map;
+    GenerationCache m_generationCache;
     MapGenerator m_mapGenerator;
     MapGenerator::GenerationSettings m_mapSettings; // Store settings for when I add saving
     unsigned int m_currentSeed; // Track current seed
+
+    // ========== Interpolation ==========
+    sf::Vector2f m_prevPlayerPos;     // Player position at the start of the last tick
+    sf::Vector2f m_tickPlayerPos;     // Held while drawing at the blended position
+    sf::Vector2f m_tickCameraCenter;
+
+    // ========== Threaded Simulation ==========
+    SimulationWorker m_simWorker;
+    RenderSnapshot m_snapshots[2];      // Front is drawn, back is written by the worker
+    int m_frontSnapshot;
+    int m_pendingTicks;                 // Handed to the worker for this frame
+    float m_pendingAlpha;
+    bool m_simInFlight;                 // True between kick and wait
+    std::vector<std::function<void()>> m_deferredActions;
     // World Items
     WorldItemPool    m_itemPool;
     ItemTypeRegistry m_itemTypeRegistry;
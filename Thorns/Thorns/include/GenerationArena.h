@@ -0,0 +1,53 @@
+#ifndef GENERATION_ARENA_H
+#define GENERATION_ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+/// <summary>
+/// Monotonic arena for everything a single map generation throws away when it's done:
+/// Poisson grids and active lists, site orderings, placement buffers, debug counts.
+///
+/// - Allocation is a pointer bump inside one buffer, deallocation does nothing
+/// - reset() at the start of each generation hands the whole buffer back in one go
+/// - A run that outgrows the buffer spills to the heap, the next reset() grows the buffer
+///   to that run's high water mark so the temporaries above stop touching the heap after a
+///   run or two. POIs, their names and the map's own storage still allocate as usual
+///
+/// Anything allocated here is gone after reset(), so only per run temporaries belong in it.
+/// Not thread safe, jobs inside a phase need their own scratch.
+/// </summary>
+class GenerationArena : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024 * 1024;
+
+    explicit GenerationArena(size_t initialCapacity = DEFAULT_CAPACITY);
+    ~GenerationArena() override = default;
+
+    GenerationArena(const GenerationArena&) = delete;
+    GenerationArena& operator=(const GenerationArena&) = delete;
+
+    // Frees everything handed out since the last reset
+    void reset();
+
+    // ========== Info ==========
+    size_t getBytesUsed() const { return m_bytesUsed; }      // Since the last reset
+    size_t getPeakBytes() const { return m_peakBytes; }      // Largest single run so far
+    size_t getCapacity() const { return m_buffer.size(); }
+    bool hasSpilled() const { return m_bytesUsed > m_buffer.size(); }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::vector<std::byte> m_buffer;
+    std::optional<std::pmr::monotonic_buffer_resource> m_resource;  // Rebuilt when the buffer grows
+    size_t m_bytesUsed = 0;
+    size_t m_peakBytes = 0;
+};
+
+#endif
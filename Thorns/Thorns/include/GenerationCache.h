@@ -0,0 +1,99 @@
+#ifndef GENERATION_CACHE_H
+#define GENERATION_CACHE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class MapSnapshot;
+
+/// <summary>
+/// Cache of generated maps keyed by a hash of the generation settings (seed included).
+/// Two levels:
+///   Memory: LRU of raw snapshot bytes, a hit is a memcpy plus the checksum pass
+///   Disk:   one snapshot file per key in the cache directory, memory mapped on a hit
+///           and promoted into the LRU
+/// Stores go into the LRU straight away, the disk write happens on a background thread so
+/// filling the cache never stalls a regeneration.
+/// </summary>
+class GenerationCache
+{
+public:
+    struct Stats
+    {
+        int memoryHits = 0;
+        int diskHits = 0;
+        int misses = 0;
+        int stores = 0;
+    };
+
+    explicit GenerationCache(const std::string& directory = "cache/maps", size_t memoryEntries = 8);
+    ~GenerationCache();
+
+    GenerationCache(const GenerationCache&) = delete;
+    GenerationCache& operator=(const GenerationCache&) = delete;
+
+    // ========== Lookup / Store ==========
+    // Loads the snapshot for key into out, false on a miss (or a corrupt disk entry, which is deleted)
+    bool find(std::uint64_t key, MapSnapshot& out);
+    void store(std::uint64_t key, std::vector<std::uint8_t>&& bytes);
+
+    // ========== Config ==========
+    void setDiskEnabled(bool enabled) { m_diskEnabled = enabled; }
+    bool isDiskEnabled() const { return m_diskEnabled; }
+    void clearMemory();
+
+    // Blocks until every queued disk write has landed
+    void flush();
+
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    using Bytes = std::shared_ptr<const std::vector<std::uint8_t>>;
+
+    struct Entry
+    {
+        std::uint64_t key;
+        Bytes bytes;
+    };
+
+    struct PendingWrite
+    {
+        std::string path;
+        Bytes bytes;
+    };
+
+    std::string pathFor(std::uint64_t key) const;
+    void insertMemory(std::uint64_t key, Bytes bytes);
+    void writerMain();
+
+    // ========== Memory LRU ==========
+    // Front is the most recently used
+    std::list<Entry> m_entries;
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> m_lookup;
+    size_t m_memoryEntries;
+
+    // ========== Disk ==========
+    std::string m_directory;
+    bool m_diskEnabled;
+
+    // Background writer, entries share their bytes with the LRU so nothing is copied
+    std::thread m_writer;
+    std::mutex m_writeMutex;
+    std::condition_variable m_writeCondition;
+    std::condition_variable m_idleCondition;
+    std::deque<PendingWrite> m_pendingWrites;
+    bool m_writing;
+    bool m_quit;
+
+    Stats m_stats;
+};
+
+#endif
@@ -6,7 +6,8 @@
 #include <SFML/Window/Mouse.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/Window.hpp>
-#include <unordered_map>
+#include <cstdint>
+#include "EnumMap.h"
 
 
 // Sources for information:
@@ -30,10 +31,11 @@ Map revision Cherno: https://youtu.be/KiB0vRi2wlc?si=c__NeniIIIjXwTsD
 /// 1)Arrays for state storage (m_currentState/m_previousState)
 ///   O(1) lookup with no hashing
 /// 
-/// 2) unordered_map for key bindings (m_keyBindings)
+/// 2) EnumMap for key bindings (m_keyBindings)
 ///    Example:
 ///     If using map we have to do a comparison i.e Step 1: Compare Fire < MoveUp ? YES, go left
 ///     Using an unorderd map used hash i.e Hash Move->bucket 9 then go through map to get 9
+///     EnumMap is an array indexed by the action, MoveUp is just slot 0, no hash or bucket
 /// 
 /// 3) memset - Sets a block of memory to a specific value(byte by byte)
 ///     memset(pointer, value, size_in_bytes)
@@ -69,6 +71,19 @@ enum class InputAction
     COUNT
 };
 
+// ========== INPUT FRAME ==========
+// Everything the game reads from InputController in one fixed tick, packed small so a
+// recording is just an array of these. PN: POD on purpose, gets written to disk as raw bytes
+struct InputFrame
+{
+    std::uint16_t actionBits = 0;     // Bit i set = InputAction i held
+    std::uint8_t mouseButtons = 0;    // Bit 0 left, bit 1 right
+    std::uint8_t padding = 0;
+    float mouseX = 0.f;               // Window-relative pixels
+    float mouseY = 0.f;
+};
+static_assert(static_cast<int>(InputAction::COUNT) <= 16, "InputFrame::actionBits needs widening");
+
 // ========== INPUT DEVICE TYPE ==========
 // Tracks which input device is currently active
 enum class InputDevice
@@ -82,8 +97,22 @@ class InputController
 public:
     InputController();
 
+    // Polls the devices and steps the state, same as applyFrame(pollFrame(window))
     void update(const sf::Window& window);
 
+    // Reads the devices into a frame without stepping anything. SFML's device queries aren't
+    // thread safe against the window, so this belongs on the main thread, and the frame gets
+    // handed to whichever thread runs the tick
+    InputFrame pollFrame(const sf::Window& window);
+
+    // ========== Replay ==========
+    // Snapshot of this tick's state, used for recording
+    InputFrame captureFrame() const;
+
+    // Steps the state forward from a recorded frame instead of polling devices.
+    // Same previous/current shuffle as update() so wasJustPressed() etc. behave identically
+    void applyFrame(const InputFrame& frame);
+
     // ========== Action Queries (Keyboard/Gamepad) ==========
     // Current frame's input state
     bool isPressed(InputAction action) const;
@@ -113,19 +142,24 @@ public:
 private:
     void initializeDefaultBindings();
     void detectActiveDevice();        // Check if gamepad was connected/disconnected
-    void updateKeyboard();
-    void updateGamepad();
-    void updateMouse(const sf::Window& window);
+    void updateKeyboard(InputFrame& frame) const;
+    void updateGamepad(InputFrame& frame) const;
+    void updateMouse(const sf::Window& window, InputFrame& frame) const;
     float applyDeadzone(float value) const;
 
+    static void setAction(InputFrame& frame, InputAction action)
+    {
+        frame.actionBits |= static_cast<std::uint16_t>(1u << static_cast<int>(action));
+    }
+
     // ========== Input State Arrays ==========
     // Array look ups for state
     bool m_currentState[static_cast<int>(InputAction::COUNT)];
     bool m_previousState[static_cast<int>(InputAction::COUNT)];
 
     // ========== Key Bindings ==========
-    // Hash map for rebindable keys
-    std::unordered_map<InputAction, sf::Keyboard::Key> m_keyBindings;
+    // Rebindable keys, array slot per action
+    EnumMap<InputAction, sf::Keyboard::Key> m_keyBindings;
 
     // ========== Mouse State ==========
     sf::Vector2f m_mousePosition;
@@ -187,4 +221,4 @@ inline bool InputController::wasRightMouseJustReleased() const
     return !m_rightMousePressed && m_previousRightMousePressed;
 }
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
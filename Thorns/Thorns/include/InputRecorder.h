@@ -0,0 +1,71 @@
+#ifndef INPUT_RECORDER_H
+#define INPUT_RECORDER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "InputController.h"
+
+/// <summary>
+/// Records one InputFrame per fixed tick and plays them back. Together with the map seed
+/// this is enough to rerun a session tick for tick, the sim only reads input through
+/// InputController and everything else steps on the fixed 60Hz timestep.
+///
+/// File layout (little endian, raw):
+///   Header  { magic "THRP", version, seed, mapWidth, mapHeight, viewport size, frame count }
+///   Frames  [frame count] x InputFrame
+/// </summary>
+class InputRecorder
+{
+public:
+    enum class Mode
+    {
+        Idle,
+        Recording,
+        Playback
+    };
+
+    // What the replay needs to recreate the session it came from
+    struct SessionInfo
+    {
+        std::uint32_t seed = 0;
+        std::uint16_t mapWidth = 0;
+        std::uint16_t mapHeight = 0;
+        std::uint16_t viewportWidth = 1920;   // Mouse positions are relative to this
+        std::uint16_t viewportHeight = 1080;
+    };
+
+    InputRecorder();
+
+    // ========== Recording ==========
+    void startRecording(const SessionInfo& info);
+    void record(const InputFrame& frame);
+    bool saveRecording(const std::string& filePath) const;
+
+    // ========== Playback ==========
+    bool loadRecording(const std::string& filePath);
+
+    // Next recorded frame, returns false once the recording has run out
+    bool nextFrame(InputFrame& outFrame);
+
+    // ========== Queries ==========
+    Mode getMode() const { return m_mode; }
+    bool isRecording() const { return m_mode == Mode::Recording; }
+    bool isPlayingBack() const { return m_mode == Mode::Playback; }
+    const SessionInfo& getSessionInfo() const { return m_info; }
+    size_t getFrameCount() const { return m_frames.size(); }
+    size_t getPlaybackPosition() const { return m_playbackIndex; }
+
+    void stop() { m_mode = Mode::Idle; }
+
+private:
+    static constexpr std::uint32_t FILE_MAGIC = 0x50524854;   // "THRP"
+    static constexpr std::uint32_t FILE_VERSION = 1;
+
+    Mode m_mode;
+    SessionInfo m_info;
+    std::vector<InputFrame> m_frames;
+    size_t m_playbackIndex;
+};
+
+#endif
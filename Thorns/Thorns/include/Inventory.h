@@ -6,7 +6,7 @@
 #include <memory>
 #include "IRenderable.h"
 #include "IUpdatable.h"
-#include "SpriteComponent.h"
+#include "SpriteView.h"
 #include "ItemType.h"
 #include <functional>
 
@@ -19,7 +19,8 @@ struct Item
     std::string name;
     std::string texturePath;
     ItemType itemType;
-    SpriteComponent sprite;
+    SpriteView sprite;
+    std::unique_ptr<sf::Texture> ownedTexture;  // Only for items loaded from their own file, atlas items view the shared atlas
     int quantity = 1;
 };
 
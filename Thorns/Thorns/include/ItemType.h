@@ -2,8 +2,9 @@
 #define ITEM_TYPE_H
 
 #include <SFML/Graphics.hpp>
+#include <iterator>
 #include <string>
-#include <unordered_map>
+#include "EnumMap.h"
 
 // ========== ITEM TYPES ==========
 enum class ItemType
@@ -44,6 +45,39 @@ struct ItemTypeData
     float        pickupRadius;       // Pixel radius at which player triggers collection
 };
 
+// ========== STATIC ITEM TABLE ==========
+// Gameplay numbers per type, indexed by ItemType. This is the one place they live, the registry
+// and Player::attack both read from it. Atlas rects come from AssetTables.h (generated from DATA)
+struct ItemStats
+{
+    ItemUseCategory useCategory;
+    const char*     name;
+    float           spriteSize;         // World render size, square
+    float           statRestoreAmount;
+    float           damage;
+    float           pickupRadius;
+};
+
+inline constexpr ItemStats ITEM_STATS[] =
+{
+    { ItemUseCategory::Consume, "Food",      32.f,  30.f,  0.f, 32.f },  // Restores 30 hunger
+    { ItemUseCategory::Consume, "Water",     32.f,  40.f,  0.f, 32.f },  // Restores 40 water
+    { ItemUseCategory::Consume, "First Aid", 32.f, 100.f,  0.f, 32.f },  // Full heal
+    { ItemUseCategory::Consume, "Bandage",   32.f,  35.f,  0.f, 32.f },
+    { ItemUseCategory::Equip,   "Knife",     32.f,   0.f, 25.f, 32.f },
+    { ItemUseCategory::Equip,   "Axe",       32.f,   0.f, 50.f, 32.f },
+    { ItemUseCategory::Equip,   "Gun",       32.f,   0.f, 75.f, 32.f },
+};
+
+static_assert(std::size(ITEM_STATS) == static_cast<size_t>(ItemType::COUNT),
+    "ITEM_STATS needs one row per ItemType, in enum order");
+
+constexpr float getItemDamage(ItemType type)
+{
+    const size_t index = static_cast<size_t>(type);
+    return index < std::size(ITEM_STATS) ? ITEM_STATS[index].damage : 0.f;
+}
+
 // ========== ITEM TYPE REGISTRY ==========
 class ItemTypeRegistry
 {
@@ -51,7 +85,8 @@ public:
     ItemTypeRegistry();
     ~ItemTypeRegistry() = default;
 
-    // Get the definitions from the asset file
+    // Debug builds re-read the atlas file so edits show up without regenerating AssetTables.h,
+    // release builds use the generated table and never touch the file
     bool loadDefinitions(const std::string& definitionsPath);
 
     // Retrieve shared data for a type. Returns nullptr if type not registered.
@@ -64,11 +99,10 @@ private:
 
     void registerDefaults();
 
-    void registerType(ItemType type, const ItemTypeData& data);
-
     static bool keyToType(const std::string& key, ItemType& outType);
 
-    std::unordered_map<ItemType, ItemTypeData> m_data;
+    // Indexed by ItemType, registerDefaults fills every row
+    EnumMap<ItemType, ItemTypeData> m_data;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,130 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <type_traits>
+
+/// <summary>
+/// Engine-wide job system, one pool of worker threads shared by generation, AI and collision
+/// so nothing has to spin up its own threads.
+///
+/// - Each worker has its own deque: it pushes and pops at the back (newest first, still hot in
+///   cache), idle workers steal from the front of someone else's
+/// - Threads that aren't workers (main, simulation worker) push into a shared slot that every
+///   worker steals from
+/// - A Counter tracks a batch of jobs
+/// - wait() never just blocks, the waiting thread runs queued jobs until its counter is done
+///
+/// Before initialize() (or with 0 workers) everything runs inline on the calling thread,
+/// so tools and headless runs behave the same, only slower.
+/// </summary>
+namespace JobSystem
+{
+    // Plain function + context so queuing a job never allocates
+    using JobFunction = void(*)(void* context, int begin, int end);
+
+    struct Counter;
+
+    struct Job
+    {
+        JobFunction function = nullptr;
+        void* context = nullptr;
+        int begin = 0;
+        int end = 0;
+        Counter* counter = nullptr;     // Decremented when the job finishes, may be null
+    };
+
+    // Jobs still to finish. Must outlive every job that points at it
+    struct Counter
+    {
+        Counter() = default;
+        Counter(const Counter&) = delete;
+        Counter& operator=(const Counter&) = delete;
+
+        bool isDone() const { return pending.load(std::memory_order_acquire) == 0; }
+
+        std::atomic<int> pending{ 0 };
+    };
+
+    // ========== Lifetime ==========
+
+    // Starts the workers. 0 = hardware_concurrency - 1, the calling thread makes up the rest
+    bool initialize(unsigned int workerCount = 0);
+
+    // Runs whatever is still queued, then joins the workers
+    void shutdown();
+
+    bool isRunning();
+
+    // Workers plus the calling thread, 1 when not running
+    unsigned int getThreadCount();
+
+    // ========== Submitting ==========
+
+    void run(const Job& job);
+
+    // Runs queued jobs on this thread until the counter reaches 0
+    void wait(Counter& counter);
+
+    // ========== Parallel For ==========
+
+    // Splits [begin, end) into chunks of at least grainSize and calls body(chunkBegin, chunkEnd)
+    // for each, on whatever threads are free. Returns once every chunk has run.
+    // Chunks never overlap, so a body that only writes its own indices needs no locking
+    template<typename Body>
+    void parallelFor(int begin, int end, int grainSize, Body&& body)
+    {
+        const int count = end - begin;
+        if (count <= 0)
+            return;
+
+        grainSize = grainSize < 1 ? 1 : grainSize;
+        const int threadCount = static_cast<int>(getThreadCount());
+
+        if (threadCount <= 1 || count <= grainSize)
+        {
+            body(begin, end);
+            return;
+        }
+
+        // A few chunks per thread so stealing can even out uneven work, never under the grain
+        int chunkCount = (count + grainSize - 1) / grainSize;
+        chunkCount = chunkCount < threadCount * 4 ? chunkCount : threadCount * 4;
+        const int chunkSize = (count + chunkCount - 1) / chunkCount;
+
+        using BodyType = std::remove_reference_t<Body>;
+        Counter counter;
+
+        Job job;
+        job.function = [](void* context, int jobBegin, int jobEnd)
+        {
+            (*static_cast<BodyType*>(context))(jobBegin, jobEnd);
+        };
+        job.context = const_cast<void*>(static_cast<const void*>(&body));
+        job.counter = &counter;
+
+        for (int chunkBegin = begin; chunkBegin < end; chunkBegin += chunkSize)
+        {
+            job.begin = chunkBegin;
+            job.end = chunkBegin + chunkSize < end ? chunkBegin + chunkSize : end;
+            run(job);
+        }
+
+        wait(counter);
+    }
+}
+
+#endif
+
+// Personal Notes Job System:
+/*
+    Work stealing: https://www.dre.vanderbilt.edu/~schmidt/PDF/work-stealing-dequeue.pdf (Chase-Lev)
+    Also the Naughty Dog fiber talk for the counter + wait idea, without the fibers.
+
+    The deques here are mutex guarded, not the lock free Chase-Lev version. Jobs are coarse
+    (row bands, object chunks, a pool of enemies) so a lock per push/pop doesn't show up in the
+    profiler, and it's a lot harder to get wrong.
+
+    Sleeping: a worker that finds nothing anywhere waits on a condition variable, run() only
+    notifies when someone is actually asleep.
+*/
@@ -0,0 +1,111 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <string>
+
+// ========== LOG LEVELS ==========
+// Ordered low -> high, a message is kept when level >= the active filter.
+enum class LogLevel : unsigned char
+{
+    Trace = 0,
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Off
+};
+
+// ========== LOG CATEGORIES ==========
+// One per module so noisy systems (AI, object placement) can be muted on their own.
+enum class LogCategory : unsigned char
+{
+    Core = 0,
+    MapGen,
+    Objects,
+    AI,
+    Player,
+    Items,
+    COUNT
+};
+
+// ========== COMPILE TIME LEVEL ==========
+// Anything below this is stripped out of the build entirely by the LOG_* macros.
+// PN: Override in project settings with THORNS_MIN_LOG_LEVEL=<0..5> if needed.
+#ifndef THORNS_MIN_LOG_LEVEL
+#ifdef _DEBUG
+#define THORNS_MIN_LOG_LEVEL 0
+#else
+#define THORNS_MIN_LOG_LEVEL 2
+#endif
+#endif
+
+/// <summary>
+/// Async logger. Callers format into a fixed slot of a lock-free ring buffer and return
+/// straight away, a background thread drains the ring to file (and optionally the console).
+/// If the ring is full the message is dropped and counted, the caller never blocks.
+/// </summary>
+namespace Logger
+{
+    // Max characters per message (longer messages get truncated)
+    inline constexpr int MAX_MESSAGE_LENGTH = 200;
+
+    // Number of ring slots, must be a power of two
+    inline constexpr int RING_CAPACITY = 1024;
+
+    // ========== Lifetime ==========
+
+    // Opens the log file and starts the drain thread
+    bool initialize(const std::string& filePath, bool echoToConsole = true);
+
+    // Flushes whatever is left in the ring and joins the drain thread
+    void shutdown();
+
+    // ========== Filtering ==========
+
+    // Runtime filter per category, sits on top of the compile time strip
+    void setCategoryLevel(LogCategory category, LogLevel level);
+    LogLevel getCategoryLevel(LogCategory category);
+    bool isEnabled(LogCategory category, LogLevel level);
+
+    // ========== Writing ==========
+
+    // printf style, use the LOG_* macros rather than calling this directly
+    void write(LogLevel level, LogCategory category, const char* format, ...);
+
+    // Messages lost because the ring was full
+    unsigned int getDroppedCount();
+
+    const char* levelName(LogLevel level);
+    const char* categoryName(LogCategory category);
+}
+
+// ========== MACROS ==========
+// if constexpr removes the call (and argument evaluation) for stripped levels.
+#define THORNS_LOG(level, category, ...)                                            \
+    do {                                                                            \
+        if constexpr (static_cast<int>(level) >= THORNS_MIN_LOG_LEVEL)              \
+        {                                                                           \
+            if (Logger::isEnabled(category, level))                                 \
+                Logger::write(level, category, __VA_ARGS__);                        \
+        }                                                                           \
+    } while (0)
+
+// True when a level would actually be written, for guarding work that only exists to feed a log
+#define LOG_ENABLED(level, category)                                                \
+    (static_cast<int>(LogLevel::level) >= THORNS_MIN_LOG_LEVEL                      \
+        && Logger::isEnabled(LogCategory::category, LogLevel::level))
+
+#define LOG_TRACE(category, ...) THORNS_LOG(LogLevel::Trace, LogCategory::category, __VA_ARGS__)
+#define LOG_DEBUG(category, ...) THORNS_LOG(LogLevel::Debug, LogCategory::category, __VA_ARGS__)
+#define LOG_INFO(category, ...)  THORNS_LOG(LogLevel::Info,  LogCategory::category, __VA_ARGS__)
+#define LOG_WARN(category, ...)  THORNS_LOG(LogLevel::Warn,  LogCategory::category, __VA_ARGS__)
+#define LOG_ERROR(category, ...) THORNS_LOG(LogLevel::Error, LogCategory::category, __VA_ARGS__)
+
+#endif
+
+// ========== Personal Notes ==========
+// Ring buffer is the bounded MPSC queue from Dmitry Vyukov. Each slot has a sequence number,
+// producers CAS the write index and then publish by bumping the slot sequence, so no mutex on the
+// hot path. Only the drain thread ever reads so the consumer side doesn't need a CAS.
+//
+// Used printf formatting over streams so nothing allocates when a message is written.
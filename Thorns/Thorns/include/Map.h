@@ -2,6 +2,7 @@
 #define MAP_HPP
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <vector>
 #include "MapTile.h"
 #include "PointOfInterest.h"
@@ -51,18 +52,37 @@ public:
     void addPOI(std::unique_ptr<PointOfInterest> poi);
     const std::vector<std::unique_ptr<PointOfInterest>>& getPOIs() const { return m_pois; }
 
-    // Check if a world position is inside any POI
+    // Check if a world position is inside any POI (tile lookup in the occupancy layer)
     bool isInsidePOI(const sf::Vector2f& worldPos) const;
 
-    // Mark tiles as POI terrain based on POI bounds
+    // Mark tiles as POI terrain from the occupancy layer's collision footprints
     void markPOITiles();
 
+    // ========== POI Occupancy ==========
+    // One cell per tile: which POI covers it (visual bounds or any collision shape, polygons
+    // included) and whether a collision shape touches it. Kept up to date by addPOI, so
+    // placement and generation passes never loop the POI list per sample
+    static constexpr int NO_POI = -1;
+
+    // Index into getPOIs(), NO_POI when the tile is clear or out of bounds
+    int getPOIIndexAt(int x, int y) const;
+    const PointOfInterest* getPOIAt(const sf::Vector2f& worldPos) const;
+    bool isPOICollisionTile(int x, int y) const;
+
+    // Full rebuild, only needed if a POI moves after being added
+    void rebuildPOIOccupancy();
+
     // ========== Rendering ==========
 
     void render(sf::RenderTarget& target) const override;
     void renderDebug(sf::RenderTarget& target) const;
     void renderVoronoiBoundaries(sf::RenderTarget& target) const;
 
+    // Region border lines, built once after the tiles are labelled and drawn from the cache.
+    // Runs of collinear tile edges are merged into one segment each
+    void buildVoronoiBoundaries();
+    size_t getVoronoiBoundarySegmentCount() const { return m_boundaryLines.getVertexCount() / 2; }
+
     // Frustrum rendering
     void renderTerrain(sf::RenderTarget& target, const sf::View& view) const;
 
@@ -81,6 +101,21 @@ private:
     // Get texture rect for a terrain type from atlas
     sf::IntRect getTerrainTextureRect(MapTile::TerrainType type) const;
 
+    // Atlas only has grass art so far, Dirt/Water/Stone reuse a grass cell tinted towards their
+    // debug colour. White (no tint) for everything with its own cell
+    static sf::Color getTerrainTint(MapTile::TerrainType type);
+
+    // ========== POI Occupancy ==========
+    struct POICell
+    {
+        std::int16_t poi = NO_POI;       // Index into m_pois
+        std::uint8_t collision = 0;      // 1 = a collision shape overlaps this tile
+        std::uint8_t padding = 0;
+    };
+
+    // Writes one POI's footprint into the occupancy layer, earlier POIs keep tiles they already own
+    void rasterizePOI(int poiIndex);
+
     // ========== Sprite Rendering ==========
 
     // Shared texture atlas for all terrain tiles
@@ -92,6 +127,10 @@ private:
     mutable sf::VertexArray m_vertexArray;
     mutable bool m_needsRebuild;
 
+    // ========== Voronoi Boundaries ==========
+    sf::VertexArray m_boundaryLines{ sf::PrimitiveType::Lines };
+    std::vector<int> m_boundaryRunStart;    // Build scratch, open vertical run per column (-1 = none)
+
     // ========== Data ==========
     int m_width;                // Map width in tiles
     int m_height;               // Map height in tiles
@@ -99,6 +138,7 @@ private:
 
     std::vector<MapTile> m_tiles;  // 1D: index = y * width + x
     std::vector<std::unique_ptr<PointOfInterest>> m_pois;
+    std::vector<POICell> m_poiOccupancy;  // Same indexing as m_tiles
 
     bool m_debugMode;           // Show tile colors instead of sprites
 };
@@ -1,10 +1,19 @@
 #ifndef MAP_GENERATOR_HPP
 #define MAP_GENERATOR_HPP
 
+#include <functional>
 #include <memory>
 #include "Map.h"
 #include "VoronoiDiagram.h"
 #include "ObjectPlacer.h"
+#include "CellularAutomata.h"
+#include "ConnectivityMap.h"
+#include "RegionGraph.h"
+#include "MapSnapshot.h"
+#include "GenerationArena.h"
+#include "Noise2D.h"
+
+class GenerationCache;
 #include "POITemplate.h"
 #include "POITypeConfig.h"
 
@@ -14,11 +23,23 @@
 ///         - Divide map into regions
 ///         - Terrain boundaries
 ///         - Ensure POIs are spaced appropriately
+/// Phase 1b: Biomes
+///         - Elevation and moisture noise plus a biome per region pick each tile's terrain
+///         - Grass, Forest, Dirt, Water, Stone, one parallel pass over the tiles
 /// Phase 2: Perlin noise for object placement
 ///         - Trees, rocks, vegetation
 ///         - Natural-looking distribution
-/// Phase 3: (TODO) Cellular automata for refinement
-/// Phase 4: (TODO) Dijkstra map for connectivity validation
+///         - Grass only layers, covers every grass patch the biomes leave however far apart
+/// Phase 3: Cellular automata for refinement
+///         - Grows grass into DeepForest thickets (unwalkable)
+///         - Bit-packed, runs before object placement so objects skip the thickets
+/// Phase 4: Connectivity validation and repair
+///         - Union-find labels the walkable components
+///         - POI entrances and Voronoi sites that can't reach the hideout get a corridor carved
+///         - Leaves a distance-from-hideout field behind for later systems
+///
+/// Reentrant: every random number comes from the seed, templates and POI configs are parsed once
+/// and shared read-only, so separate instances can generate on separate threads (generateBatch).
 /// </summary>
 class MapGenerator
 {
@@ -52,6 +73,16 @@ public:
         float minSiteDistance = 0.0f; // Min distance between site in pixels, leave at 0 of for the auto derive
         unsigned int seed = 0;       // Random seed (0 = random)
 
+        // Lloyd relaxation passes after the Poisson sites, each moves every site to the centroid
+        // of its region so region sizes even out. Stops early once no site moves, 0 = off
+        unsigned char lloydIterations = 2;
+
+
+        // ========== Biomes ==========
+        // Elevation + moisture noise, shifted per Voronoi region by that region's biome, picks
+        // each tile's terrain. Off = every tile stays grass
+        bool enableBiomes = true;
+        float biomeFrequency = 0.04f;           // Noise frequency per tile, lower = bigger lakes and ridges
 
         // ========== POI Generation ==========
         unsigned char numVillages = 1;
@@ -63,6 +94,22 @@ public:
         int objectOctaves = 2;                  // Number of noise layers
         double objectThreshold = 0.65;          // Placement threshold
 
+        // ========== Refinement (Cellular Automata) ==========
+        // Rule masks: bit n set = n live neighbours triggers it. Defaults are the B5678/S45678 cave rules
+        bool enableCellularAutomata = true;     // Enable/disable Phase 3
+        float caFillChance = 0.42f;             // Chance a grass tile starts as thicket
+        int caIterations = 4;                   // Generations to run
+        unsigned short caBirthMask = 0x1E0;     // B5678
+        unsigned short caSurvivalMask = 0x1F0;  // S45678
+        unsigned int caThreadCount = 0;         // Max row bands, 0 = every JobSystem thread, 1 = calling thread only
+
+        // ========== Connectivity ==========
+        bool enableConnectivityRepair = true;   // Enable/disable Phase 4 (linear, cheap enough to leave on)
+
+        // Hash of everything that changes the generated map, including which site mode is active.
+        // caThreadCount is left out, the automata gives the same result on any thread count
+        std::uint64_t cacheKey() const;
+
         // Derives the min distance for the current way of setting points (Poisson), 
         // make each site own an even share of the map, solve issue with sites not covering map sections
         // Get size total, divide to get each area each site roughly holds, distance for sites
@@ -79,6 +126,33 @@ public:
 
     };
 
+    // What a generation produced and how long each phase took, filled in by every generate/regenerate
+    struct GenerationReport
+    {
+        unsigned int seed = 0;          // Seed actually used, a random one if settings.seed was 0
+        bool fromCache = false;         // Restored from the cache, counts are filled but no phase ran
+
+        int siteCount = 0;
+        int relaxIterations = 0;        // Lloyd passes actually run
+        int poiCount = 0;               // Including the hideout
+        int objectCount = 0;
+        int thicketTiles = 0;
+        ConnectivityMap::Report connectivity;
+        size_t arenaBytes = 0;          // Scratch the run took from the generation arena
+
+        double voronoiMs = 0.0;         // Phase 1 + POI spawning
+        double biomeMs = 0.0;
+        double automataMs = 0.0;
+        double connectivityMs = 0.0;
+        double objectsMs = 0.0;
+        double totalMs = 0.0;
+    };
+
+    // Called once per seed from the thread that generated it, so it has to be thread safe.
+    // The map and generator are reused for the next seed, only valid during the call
+    using BatchCallback = std::function<void(MapGenerator& generator, const Map& map,
+        const GenerationReport& report)>;
+
     MapGenerator();
     ~MapGenerator() = default;
 
@@ -89,20 +163,81 @@ public:
     // Regenerate existing map with new seed
     void regenerate(Map* map, const GenerationSettings& settings);
 
+    // ========== Batch ==========
+    // Generates one map per seed on up to threadCount threads (0 = hardware_concurrency), each
+    // thread with its own generator and map. Runs quiet and headless, no cache.
+    // Reports come back in the same order as seeds
+    static std::vector<GenerationReport> generateBatch(const GenerationSettings& settings,
+        const std::vector<unsigned int>& seeds, unsigned int threadCount = 0,
+        const BatchCallback& onGenerated = nullptr);
+
+    // ========== Output ==========
+    // Quiet drops the per phase info logging, the report still has everything. Warnings still log
+    void setQuiet(bool quiet) { m_quiet = quiet; }
+    // Headless skips every texture (POI sprites, object atlas), layout and collision are unchanged.
+    // Set before the first generation, the object atlas is only loaded once
+    void setHeadless(bool headless) { m_headless = headless; }
+
+    const GenerationReport& getLastReport() const { return m_report; }
+
+    // ========== Snapshots ==========
+    // Rebuild a map from a snapshot instead of running the phases. Tiles, POIs, sites and objects
+    // come straight from the file, only the connectivity labels and distance field are recomputed
+    std::unique_ptr<Map> load(const MapSnapshot& snapshot);
+    bool restore(Map* map, const MapSnapshot& snapshot);
+
+    // Serialise the current map, sites and object placements (spawns are passed in as used by the game)
+    void buildSnapshot(const Map* map, unsigned int seed,
+        const std::vector<sf::Vector2f>& enemySpawns,
+        const std::vector<sf::Vector2f>& itemSpawns,
+        std::vector<std::uint8_t>& out) const;
+
+    // ========== Cache ==========
+    // Bump whenever a phase changes what a seed produces, old cache entries stop matching
+    static constexpr std::uint32_t GENERATOR_VERSION = 8;
+
+    // Non-owning, null disables caching. Random seeds (seed 0) are never cached
+    void setCache(GenerationCache* cache) { m_cache = cache; }
+
     // ========== Phase Access (for debugging) ==========
     VoronoiDiagram* getVoronoiDiagram() { return m_voronoi.get(); }
     ObjectPlacer* getObjectPlacer() { return m_objectPlacer.get(); }
+    const ConnectivityMap& getConnectivity() const { return m_connectivity; }
+    // Per region stats and adjacency from phase 1, rebuilt on snapshot restore too
+    const RegionGraph& getRegionGraph() const { return m_regionGraph; }
 
 
-    // Enemy spawning
-    std::vector<sf::Vector2f> getEnemySpawnPoints(int countPerPOI = 2, float spawnRadius = 300.f) const;
-    // Item Spawning
-    std::vector<sf::Vector2f> getItemSpawnPoints(float spawnRadius = 200.f) const;
+    // Enemy spawning, Poisson samples within spawnRadius of each site (clears out first)
+    void getEnemySpawnPoints(const Map* map, std::vector<sf::Vector2f>& out,
+        int countPerPOI = 2, float spawnRadius = 300.f);
+    // Item Spawning, one per site
+    void getItemSpawnPoints(const Map* map, std::vector<sf::Vector2f>& out, float spawnRadius = 200.f);
 
 private:
     // ========== Generation Phases ==========
+    // Shared by generate and regenerate, settings.seed is already resolved (never 0)
+    void runPhases(Map* map, const GenerationSettings& settings);
+
     void phase1_Voronoi(Map* map, const GenerationSettings& settings);
+    void phase1b_Biomes(Map* map, const GenerationSettings& settings);
     void phase2_PerlinObjects(Map* map, const GenerationSettings& settings);
+    void phase3_CellularAutomata(Map* map, const GenerationSettings& settings);
+    void phase4_Connectivity(Map* map);
+
+    // Object atlas + definitions, loaded once on first use (phase 2 or a snapshot restore)
+    bool ensureObjectAssets();
+
+    // Cache hit restores the map and returns true, a finished generation is stored on the way out
+    bool restoreFromCache(Map* map, const GenerationSettings& settings);
+    void storeInCache(const Map* map, const GenerationSettings& settings);
+
+    // Appends up to countPerSite walkable, POI free points around each site (hideout site skipped).
+    // Seeded from the site tile so the same map always gives the same spawns
+    void sampleSpawnPoints(const Map* map, int countPerSite, float spawnRadius, float spacing,
+        std::uint32_t salt, std::vector<sf::Vector2f>& out);
+
+    // Tile just below a POI's sprite, stands in for its entrance
+    sf::Vector2i getPOIEntranceTile(const Map* map, const PointOfInterest& poi) const;
 
     // ========== Generation Phases ==========
     unsigned char calSiteOptimalCount(SiteDensity density, const GenerationSettings& settings) const;
@@ -116,8 +251,14 @@ private:
     // Spawn POIs at Voronoi sites based on settings
     void spawnPOIsAtSites(Map* map, const GenerationSettings& settings);
 
-    POIConfigRegistry m_poiConfig;
-    POITemplateManager m_poiTemplates;
+    // POI configs and templates never change after loading, one copy per process
+    struct SharedData
+    {
+        POIConfigRegistry poiConfig;
+        POITemplateManager poiTemplates;
+    };
+    static std::shared_ptr<const SharedData> loadSharedData();
+    std::shared_ptr<const SharedData> m_shared;
 
     std::unique_ptr<PointOfInterest> createPOI(
         PointOfInterest::Type type,
@@ -127,16 +268,59 @@ private:
     // Helper to pick random POI type
     PointOfInterest::Type getRandomPOIType(int& villagesLeft, int& farmsLeft,std::mt19937& rng);
 
+    // ========== Scratch ==========
+    // Per generation temporaries, reset at the start of every run. Declared ahead of the
+    // phases that point at it
+    GenerationArena m_arena;
+
     // ========== Algorithm Instances ========== (Only pointers incase pointer to phase later is needed)
     std::unique_ptr<VoronoiDiagram> m_voronoi;
     std::unique_ptr<ObjectPlacer> m_objectPlacer;
+    CellularAutomata m_automata;    // Kept between regenerations so the grids are reused
+    ConnectivityMap m_connectivity; // Also holds the distance-from-hideout field
+    RegionGraph m_regionGraph;      // Filled by the phase 1 labelling bands
+    std::vector<sf::Vector2i> m_connectivityTargets;
+
+    // Biome fields, reseeded every run
+    Noise2D m_elevationNoise;
+    Noise2D m_moistureNoise;
+
+    // Spawn point sampling runs between generations too, so it can't use the arena. The pool
+    // keeps freed blocks, repeated calls stop allocating after the first
+    std::pmr::unsynchronized_pool_resource m_spawnPool;
+    PoissonSampler m_spawnSampler;
+    PoissonSampler::PointList m_spawnSamples{ &m_spawnPool };
+
+    // Tiles kept clear of thickets around POIs and Voronoi sites
+    static constexpr int POI_CLEARING_TILES = 2;
+    static constexpr int SITE_CLEARING_TILES = 2;
+
+    // Map rows per job when assigning tiles to Voronoi regions (and classifying biomes)
+    static constexpr int VORONOI_ROWS_PER_JOB = 16;
+    // Octaves for the elevation and moisture fields, fixed so the fBm unrolls
+    static constexpr int BIOME_OCTAVES = 4;
+    // Stack scratch per band for the nearby site lookups. Cells are minSiteDistance wide so one
+    // holds two sites at most, a 3x3 block never gets near this
+    static constexpr size_t NEARBY_SCRATCH_SITES = 64;
+
+    // Per band running totals of each region's tiles, the Lloyd centroids are summed from these
+    struct RegionSums
+    {
+        std::int64_t sumX = 0;
+        std::int64_t sumY = 0;
+        int tileCount = 0;
+    };
 
     // Store hideout position for Voronoi generation
     sf::Vector2f m_hideoutPosition;
 
     // Other locals
     bool m_perlinAssetsInit = false;
+    bool m_quiet = false;
+    bool m_headless = false;
+    GenerationCache* m_cache = nullptr;
+    GenerationReport m_report;
 
 };
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
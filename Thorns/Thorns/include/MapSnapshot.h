@@ -0,0 +1,179 @@
+#ifndef MAP_SNAPSHOT_H
+#define MAP_SNAPSHOT_H
+
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+
+class Map;
+class WorldObject;
+struct VoronoiSite;
+
+/// <summary>
+/// Binary snapshot of a generated world, enough to rebuild it without running any generation phase.
+///
+/// File layout (little endian, raw, every section 8 byte aligned):
+///   Header        { magic "THMS", version, sizes, seed, FNV-1a checksum of the payload, section table }
+///   terrain       [w*h] uint8   MapTile::TerrainType
+///   walkable      [w*h] uint8
+///   regions       [w*h] int32   Voronoi region per tile
+///   sites         [n]   SiteRecord
+///   pois          [n]   POIRecord
+///   objects       [n]   ObjectRecord (WorldObject placements)
+///   enemySpawns   [n]   SpawnRecord
+///   itemSpawns    [n]   SpawnRecord
+///
+/// Loading maps the file (or adopts an in-memory buffer) and hands out views straight into it,
+/// nothing is parsed or copied until the caller applies it to a Map.
+/// </summary>
+class MapSnapshot
+{
+public:
+    static constexpr std::uint32_t FILE_MAGIC = 0x534D4854;    // "THMS"
+    static constexpr std::uint32_t FILE_VERSION = 1;
+
+    // ========== Records ==========
+    struct Section
+    {
+        std::uint32_t offset;   // Bytes from the start of the file
+        std::uint32_t count;    // Elements, not bytes
+    };
+
+    struct Header
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t headerSize;
+        std::uint32_t seed;
+        std::uint16_t width;        // Tiles
+        std::uint16_t height;
+        float tileSize;
+        std::uint64_t payloadSize;  // Everything after the header
+        std::uint64_t checksum;     // FNV-1a 64 of the payload
+
+        Section terrain;
+        Section walkable;
+        Section regions;
+        Section sites;
+        Section pois;
+        Section objects;
+        Section enemySpawns;
+        Section itemSpawns;
+    };
+
+    struct SiteRecord
+    {
+        float x, y;
+        std::int32_t tileX, tileY;
+        std::int32_t regionId;
+        std::uint8_t r, g, b;
+        std::uint8_t hasPOI;
+    };
+
+    struct POIRecord
+    {
+        std::uint8_t type;          // PointOfInterest::Type
+        std::uint8_t padding[3];
+        std::int32_t instance;      // "Farm 2" -> 2, name is rebuilt from the type config
+        float x, y;
+    };
+
+    struct ObjectRecord
+    {
+        std::uint8_t type;          // WorldObject::Type
+        std::uint8_t padding[3];
+        float x, y;
+    };
+
+    struct SpawnRecord
+    {
+        float x, y;
+    };
+
+    // Pointer + count into the mapped bytes, valid while the snapshot stays open
+    template<typename T>
+    class ArrayView
+    {
+    public:
+        ArrayView(const T* data, size_t size) : m_data(data), m_size(size) {}
+
+        const T* data() const { return m_data; }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        const T* begin() const { return m_data; }
+        const T* end() const { return m_data + m_size; }
+        const T& operator[](size_t i) const { return m_data[i]; }
+
+    private:
+        const T* m_data;
+        size_t m_size;
+    };
+
+    // What goes into a snapshot, all non-owning
+    struct Contents
+    {
+        const Map* map = nullptr;
+        const std::vector<VoronoiSite>* sites = nullptr;
+        const std::vector<WorldObject>* objects = nullptr;
+        const std::vector<sf::Vector2f>* enemySpawns = nullptr;
+        const std::vector<sf::Vector2f>* itemSpawns = nullptr;
+        std::uint32_t seed = 0;
+    };
+
+    MapSnapshot();
+    ~MapSnapshot() = default;
+
+    MapSnapshot(const MapSnapshot&) = delete;
+    MapSnapshot& operator=(const MapSnapshot&) = delete;
+
+    // ========== Writing ==========
+    // Serialises into out, which is resized but keeps its capacity between calls
+    static void build(const Contents& contents, std::vector<std::uint8_t>& out);
+    static bool writeFile(const std::string& filePath, const std::vector<std::uint8_t>& bytes);
+
+    // ========== Loading ==========
+    bool loadFile(const std::string& filePath);              // Memory mapped, zero copy
+    bool loadBytes(std::vector<std::uint8_t>&& bytes);       // Takes ownership of an in-memory snapshot
+    void close();
+
+    bool isValid() const { return m_header != nullptr; }
+
+    // ========== Views ==========
+    const Header& getHeader() const { return *m_header; }
+    ArrayView<std::uint8_t> getTerrain() const { return view<std::uint8_t>(m_header->terrain); }
+    ArrayView<std::uint8_t> getWalkable() const { return view<std::uint8_t>(m_header->walkable); }
+    ArrayView<std::int32_t> getRegions() const { return view<std::int32_t>(m_header->regions); }
+    ArrayView<SiteRecord> getSites() const { return view<SiteRecord>(m_header->sites); }
+    ArrayView<POIRecord> getPOIs() const { return view<POIRecord>(m_header->pois); }
+    ArrayView<ObjectRecord> getObjects() const { return view<ObjectRecord>(m_header->objects); }
+    ArrayView<SpawnRecord> getEnemySpawns() const { return view<SpawnRecord>(m_header->enemySpawns); }
+    ArrayView<SpawnRecord> getItemSpawns() const { return view<SpawnRecord>(m_header->itemSpawns); }
+
+    // Raw snapshot, mapped or owned
+    const std::uint8_t* getBytes() const { return m_data; }
+    size_t getByteSize() const { return m_size; }
+
+    static std::uint64_t computeChecksum(const std::uint8_t* data, size_t size);
+
+private:
+    // Checks magic, version, section bounds and the checksum before anything is handed out
+    bool attach(const std::uint8_t* data, size_t size, const std::string& source);
+
+    template<typename T>
+    ArrayView<T> view(const Section& section) const
+    {
+        return { reinterpret_cast<const T*>(m_data + section.offset), section.count };
+    }
+
+    MappedFile m_file;
+    std::vector<std::uint8_t> m_ownedBytes;
+    const std::uint8_t* m_data;
+    size_t m_size;
+    const Header* m_header;
+};
+
+#endif
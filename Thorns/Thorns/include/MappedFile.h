@@ -0,0 +1,43 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// <summary>
+/// Read-only memory mapped file. The OS pages the file in on first touch, so "loading" a
+/// large file costs nothing up front and readers get pointers straight into the page cache.
+/// Win32 (CreateFileMapping/MapViewOfFile) and POSIX (mmap) versions live in the .cpp
+/// </summary>
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // ========== Lifetime ==========
+    bool open(const std::string& filePath);
+    void close();
+
+    // ========== Access ==========
+    const std::uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool isOpen() const { return m_data != nullptr; }
+
+private:
+    const std::uint8_t* m_data;
+    size_t m_size;
+
+#ifdef _WIN32
+    void* m_fileHandle;
+    void* m_mappingHandle;
+#else
+    int m_fileDescriptor;
+#endif
+};
+
+#endif
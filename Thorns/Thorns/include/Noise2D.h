@@ -0,0 +1,196 @@
+#ifndef NOISE_2D_H
+#define NOISE_2D_H
+
+#include <array>
+#include <cstdint>
+
+/// <summary>
+/// 2D gradient noise kernels in float, for anything that samples noise per tile, per object
+/// or per frame.
+///
+/// - perlin(): Ken Perlin's improved noise cut down to 2D, 4 corners instead of the 3D 8
+/// - simplex(): OpenSimplex2 style simplex noise, 3 corners on a triangular lattice, no
+///   square grid look along the axes
+/// - Both return roughly [-1, 1]. The fBm helpers return [0, 1], the range the placement and
+///   biome thresholds are written against
+///
+/// Octave counts are a template parameter, so the fBm loop has a fixed trip count and unrolls.
+/// The int overloads are for data driven counts (placement layers), they switch once into the
+/// matching instantiation. Kernels are inline here so the callers' loops can inline them too.
+/// </summary>
+class Noise2D
+{
+public:
+    static constexpr int MAX_OCTAVES = 8;
+
+    Noise2D();
+    explicit Noise2D(std::uint32_t seed);
+
+    // Reshuffles the permutation, same seed = same noise on any compiler
+    void reseed(std::uint32_t seed);
+
+    // ========== Kernels ==========
+    inline float perlin(float x, float y) const;
+    inline float simplex(float x, float y) const;
+
+    // ========== Fractal (fBm) ==========
+    // Each octave doubles the frequency and scales the amplitude by persistence, result in [0, 1]
+    template<int Octaves>
+    float perlinFbm(float x, float y, float persistence = 0.5f) const
+    {
+        return fbm<Octaves, &Noise2D::perlin>(x, y, persistence);
+    }
+
+    template<int Octaves>
+    float simplexFbm(float x, float y, float persistence = 0.5f) const
+    {
+        return fbm<Octaves, &Noise2D::simplex>(x, y, persistence);
+    }
+
+    // Runtime octave count, clamped to [1, MAX_OCTAVES]
+    float perlinFbm(float x, float y, int octaves, float persistence = 0.5f) const;
+    float simplexFbm(float x, float y, int octaves, float persistence = 0.5f) const;
+
+private:
+    using Kernel = float (Noise2D::*)(float, float) const;
+
+    template<int Octaves, Kernel Sample>
+    float fbm(float x, float y, float persistence) const
+    {
+        static_assert(Octaves >= 1 && Octaves <= MAX_OCTAVES, "Noise2D: octave count out of range");
+
+        float total = 0.f;
+        float amplitude = 1.f;
+        float maxValue = 0.f;   // Sum of the amplitudes, normalises back to [-1, 1]
+
+        for (int i = 0; i < Octaves; ++i)
+        {
+            total += (this->*Sample)(x, y) * amplitude;
+            maxValue += amplitude;
+
+            x *= 2.f;
+            y *= 2.f;
+            amplitude *= persistence;
+        }
+
+        // Remap from [-1, 1] to [0, 1], clamped since simplex can poke just past 1
+        const float value = 0.5f * (total / maxValue) + 0.5f;
+        return value < 0.f ? 0.f : (value > 1.f ? 1.f : value);
+    }
+
+    // Permutation hash of a lattice point, any ints (wraps every 256 cells)
+    std::uint8_t hash(int x, int y) const
+    {
+        return m_permutation[m_permutation[x & 255] + (y & 255)];
+    }
+
+    // std::floor is a library call without SSE4.1, truncation and a fix up for negatives isn't
+    static int fastFloor(float value)
+    {
+        const int truncated = static_cast<int>(value);
+        return value < static_cast<float>(truncated) ? truncated - 1 : truncated;
+    }
+
+    static float fade(float t) { return t * t * t * (t * (t * 6.f - 15.f) + 10.f); }
+    static float lerp(float t, float a, float b) { return a + t * (b - a); }
+
+    // 0-255 shuffled, then repeated so hash() never has to wrap the second lookup
+    std::array<std::uint8_t, 512> m_permutation;
+};
+
+// ========================================================================================================
+// KERNELS
+// ========================================================================================================
+inline float Noise2D::perlin(float x, float y) const
+{
+    // Cell and position inside it
+    const int cellX = fastFloor(x);
+    const int cellY = fastFloor(y);
+    x -= static_cast<float>(cellX);
+    y -= static_cast<float>(cellY);
+
+    // Diagonal gradients only, (+-1, +-1) keeps the result exactly inside [-1, 1]
+    auto grad = [](std::uint8_t h, float dx, float dy)
+    {
+        return ((h & 1) ? -dx : dx) + ((h & 2) ? -dy : dy);
+    };
+
+    const float u = fade(x);
+    const float v = fade(y);
+
+    const float bottom = lerp(u, grad(hash(cellX, cellY), x, y), grad(hash(cellX + 1, cellY), x - 1.f, y));
+    const float top = lerp(u, grad(hash(cellX, cellY + 1), x, y - 1.f), grad(hash(cellX + 1, cellY + 1), x - 1.f, y - 1.f));
+    return lerp(v, bottom, top);
+}
+
+inline float Noise2D::simplex(float x, float y) const
+{
+    // Skew onto the triangular lattice, (sqrt(3) - 1) / 2 and its unskew (3 - sqrt(3)) / 6
+    constexpr float SKEW = 0.36602540378f;
+    constexpr float UNSKEW = 0.21132486540f;
+    constexpr float RADIUS_SQ = 0.5f;       // Kernel radius, contributions fall to 0 at the edge
+    constexpr float NORMALISE = 99.2f;      // Peak of the summed kernels with unit gradients, back to ~[-1, 1]
+
+    // 16 unit gradients, 22.5 degrees apart
+    static constexpr float GRADIENTS[16][2] =
+    {
+        { 1.f, 0.f }, { 0.92388f, 0.38268f }, { 0.70711f, 0.70711f }, { 0.38268f, 0.92388f },
+        { 0.f, 1.f }, { -0.38268f, 0.92388f }, { -0.70711f, 0.70711f }, { -0.92388f, 0.38268f },
+        { -1.f, 0.f }, { -0.92388f, -0.38268f }, { -0.70711f, -0.70711f }, { -0.38268f, -0.92388f },
+        { 0.f, -1.f }, { 0.38268f, -0.92388f }, { 0.70711f, -0.70711f }, { 0.92388f, -0.38268f },
+    };
+
+    auto corner = [&](int cornerX, int cornerY, float dx, float dy)
+    {
+        float falloff = RADIUS_SQ - dx * dx - dy * dy;
+        if (falloff <= 0.f)
+            return 0.f;
+
+        const float* g = GRADIENTS[hash(cornerX, cornerY) & 15];
+        falloff *= falloff;
+        return falloff * falloff * (g[0] * dx + g[1] * dy);
+    };
+
+    // Base corner of the skewed cell
+    const float skew = (x + y) * SKEW;
+    const int cellX = fastFloor(x + skew);
+    const int cellY = fastFloor(y + skew);
+
+    // Offset from the base corner back in normal space
+    const float unskew = (cellX + cellY) * UNSKEW;
+    const float x0 = x - (cellX - unskew);
+    const float y0 = y - (cellY - unskew);
+
+    // Which of the cell's two triangles, picks the middle corner
+    const int stepX = x0 > y0 ? 1 : 0;
+    const int stepY = 1 - stepX;
+
+    const float x1 = x0 - stepX + UNSKEW;
+    const float y1 = y0 - stepY + UNSKEW;
+    const float x2 = x0 - 1.f + 2.f * UNSKEW;
+    const float y2 = y0 - 1.f + 2.f * UNSKEW;
+
+    const float sum = corner(cellX, cellY, x0, y0)
+        + corner(cellX + stepX, cellY + stepY, x1, y1)
+        + corner(cellX + 1, cellY + 1, x2, y2);
+    return sum * NORMALISE;
+}
+
+#endif
+
+// Personal Notes Noise 2D:
+/*
+    Replaced the old PerlinNoise class (removed once nothing used it). Its noise2D was the full 3D
+    noise with z = 0, so 8 corners and 7 lerps in double for what 4 corners and 3 lerps do in 2D.
+    Table was a vector<int> of 512 (2KB), the byte table is 512 bytes and sits in a handful of
+    cache lines.
+
+    Simplex vs Perlin: Perlin's square cells line features up with the axes a bit, simplex uses
+    triangles (3 corners instead of 4) so it's cheaper and has no grid look.
+    OpenSimplex2: https://github.com/KdotJPG/OpenSimplex2 (same skew and kernel idea, simpler
+    gradient table here)
+    Stefan Gustavson, "Simplex noise demystified": https://weber.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
+
+    Template octaves: for (i < Octaves) with Octaves known at compile time has a fixed trip count,
+    so the compiler unrolls it and keeps everything in registers.
+*/
@@ -1,14 +1,18 @@
 #ifndef OBJECT_PLACER_HPP
 #define OBJECT_PLACER_HPP
 
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <vector>
-#include <unordered_map>
 #include <string>
 #include <SFML/Graphics.hpp>
-#include "PerlinNoise.h"
+#include "Noise2D.h"
+#include "PoissonSampler.h"
 #include "WorldObject.h"
 #include "WorldObjectTemplate.h"
+#include "EnumMap.h"
+#include "MapTile.h"
 
 class Map;
 
@@ -16,22 +20,33 @@ class Map;
 /// Manages procedural object placement using Perlin noise
 /// 
 /// Strategy:
-/// 1. Generate Perlin noise value for each tile
-/// 2. Apply threshold to determine if object should be placed
-/// 3. Use noise value to select object variant
-/// 4. Respect terrain types and POI exclusions
+/// 1. Poisson sample candidate positions once for every layer (one per object kind)
+/// 2. Shared checks per candidate (tile, walkability, POI exclusions)
+/// 3. Each layer has its own noise, threshold and terrain mask, the highest priority
+///    layer that passes claims the candidate
+/// 4. Claimed candidates are placed in priority order, layer spacing is checked against
+///    everything already placed, so big objects clear room before small ones fill in
 /// 
 /// Performance:
 /// - Objects generated during map creation (not runtime)
-/// - Frustum culling during rendering
-/// - Shared texture atlas for all objects
+/// - Objects are compact records stored by value, no per object sprite or allocation
+/// - Frustum culling during rendering, visible objects become quads in one vertex array
+/// - Shared texture atlas for all objects, so the whole batch is one draw call
 /// </summary>
 class ObjectPlacer
 {
 public:
-    // Configuration for object placement
-    struct PlacementSettings
+    static constexpr std::uint32_t terrainBit(MapTile::TerrainType terrain)
+    {
+        return 1u << static_cast<std::uint32_t>(terrain);
+    }
+
+    // One kind of object and where it's allowed to go
+    struct PlacementLayer
     {
+        // ========== Object Type ==========
+        WorldObject::Type objectType = WorldObject::Type::SmallRoot;
+
         // ========== Noise Parameters ==========
         double frequency = 0.1;          // Lower = larger patterns, Higher = smaller patterns
         int octaves = 2;                 // Number of noise layers (more = more detail)
@@ -39,14 +54,22 @@ public:
 
         // ========== Placement Rules ==========
         double placementThreshold = 0.6; // Only place if noise > threshold
-        double spacing = 32.0;           // Minimum distance between objects (pixels)
+        double spacing = 96.0;           // Minimum distance to any other placed object (pixels)
+        std::uint32_t terrainMask = terrainBit(MapTile::TerrainType::Grass);  // Allowed terrain, terrainBit() OR'd
+        int priority = 0;                // Higher claims overlapping spots first
+    };
 
-        // ========== Object Type ==========
-        WorldObject::Type objectType = WorldObject::Type::SmallRoot;
+    // Configuration for object placement
+    struct PlacementSettings
+    {
+        std::vector<PlacementLayer> layers;
+
+        // Candidate spacing where no layer is above its threshold, the densest spacing
+        // is the smallest layer spacing
+        double maxSpacing = 256.0;
 
         // ========== Filtering ==========
         bool respectPOIs = true;         // Don't place objects in POI areas
-        bool grassOnly = true;           // Only place on grass terrain
     };
 
     ObjectPlacer();
@@ -54,22 +77,34 @@ public:
 
     // ========== Initialization ==========
 
-    // Load object atlas and parse object definitions
+    // Load object atlas and parse object definitions.
+    // An empty atlasPath runs headless: no texture, objects are still placed with their collision
+    // but render() draws nothing. Used by batch generation, where nothing is ever on screen
     bool initialize(const std::string& atlasPath,
         const std::string& definitionsPath,
         const std::string& collisionTmxPath = "");
 
     // ========== Object Generation ==========
 
-    // Generate objects for entire map using Perlin noise
+    // Generate objects for entire map using Perlin noise, every layer in one pass
     void generateObjects(Map* map, const PlacementSettings& settings, unsigned int seed);
 
+    // Place a single object of a type at a world position (sprite + collision), no rule checks.
+    // Used by generateObjects and when rebuilding placements from a snapshot
+    bool placeObject(WorldObject::Type type, const sf::Vector2f& worldPos);
+
     // Clear all placed objects
     void clearObjects();
 
+    // Pre-size the object list when the count is known up front
+    void reserveObjects(size_t count) { m_objects.reserve(count); }
+
+    // Placement temporaries come from here, null = the default heap. Non-owning, the generator's arena
+    void setScratchResource(std::pmr::memory_resource* resource) { m_scratch = resource; }
+
     // ========== Rendering ==========
 
-    // Render visible objects (with frustum culling)
+    // Render visible objects (with frustum culling) as one batched draw
     void render(sf::RenderTarget& target, const sf::View& view) const;
 
     // Render debug visualization (noise values, placement points)
@@ -77,8 +112,9 @@ public:
 
     // ========== Queries ==========
 
+    bool isInitialized() const { return m_initialized; }
     int getObjectCount() const { return m_objects.size(); }
-    const std::vector<std::unique_ptr<WorldObject>>& getObjects() const { return m_objects; }
+    const std::vector<WorldObject>& getObjects() const { return m_objects; }
 
 private:
     // ========== Object Definitions ==========
@@ -93,33 +129,69 @@ private:
 
     // ========== Helper Methods ==========
 
-    // Parse object definitions from text file
+    // Definitions come from AssetTables.h, debug builds also re-read the text file
+    void registerDefinitions();
     bool parseDefinitions(const std::string& definitionsPath);
 
-    // Check if position is valid for object placement
-    bool isValidPlacement(const sf::Vector2f& worldPos, Map* map, const PlacementSettings& settings) const;
+    // Checks every layer shares (tile exists, walkable), hands back the terrain for the layer masks
+    bool isValidPlacement(const sf::Vector2f& worldPos, const Map* map, MapTile::TerrainType& outTerrain) const;
+
+    // ========== Placement Scratch ==========
+    // Only lives for one generateObjects() call, everything is on the scratch resource
+    struct PlacementScratch
+    {
+        explicit PlacementScratch(std::pmr::memory_resource* resource)
+            : samplePoints(resource)
+            , sampleLayers(resource)
+            , layerOrder(resource)
+            , layerNoise(resource)
+            , placementOrder(resource)
+            , cellHeads(resource)
+            , cellNext(resource)
+        {
+        }
+
+        PoissonSampler::PointList samplePoints;
+        std::pmr::vector<int> sampleLayers;    // Winning layer per sample, parallel to samplePoints
+        std::pmr::vector<int> layerOrder;      // Layer indices, highest priority first
+        std::pmr::vector<float> layerNoise;    // Noise per layer for the candidate being tested
+        std::pmr::vector<int> placementOrder;  // Sample indices in placement order
+        std::pmr::vector<int> cellHeads;       // Spacing grid, first placed sample per cell (-1 = none)
+        std::pmr::vector<int> cellNext;        // Next placed sample in the same cell
+    };
+
+    // Places the claimed candidates highest priority first, skipping any inside another's spacing
+    int resolvePlacements(const PlacementSettings& settings, const sf::Vector2f& worldSize, PlacementScratch& scratch);
 
     // Get object definition for a type
     const ObjectDefinition* getDefinition(WorldObject::Type type) const;
 
     // ========== Data ==========
 
-    std::unique_ptr<PerlinNoise> m_perlin;
-    std::vector<std::unique_ptr<WorldObject>> m_objects;
+    Noise2D m_noise;                // Reseeded by each generateObjects()
+    std::vector<WorldObject> m_objects;
+
+    // Quads for the visible objects, rebuilt each render. Capacity sticks around between frames
+    mutable sf::VertexArray m_batchVertices;
+
+    // ========== Placement ==========
+    PoissonSampler m_sampler;
+    std::pmr::memory_resource* m_scratch = nullptr;
 
     // Shared single atlas
     sf::Texture m_sharedAtlasTexture;
     bool m_atlasTextureLoaded;
+    bool m_headless = false;
 
     // Object atlas
     std::string m_atlasPath;
-    std::unordered_map<WorldObject::Type, ObjectDefinition> m_definitions;
+    EnumMap<WorldObject::Type, ObjectDefinition> m_definitions; // Indexed by type
 
     bool m_initialized;
 
-    // Collision
-    WorldObjectTemplateManager m_templateManager;
-    bool m_templatesLoaded = false;
+    // Collision, shared read-only between every placer. Objects point into it so it has to
+    // live as long as they do
+    std::shared_ptr<const WorldObjectTemplateManager> m_templateManager;
 };
 
 #endif
@@ -129,4 +201,4 @@ private:
 // ========================================================================================================
 /*
  * To be worked on
- */
\ No newline at end of file
+ */
\ No newline at end of file
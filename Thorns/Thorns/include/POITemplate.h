@@ -27,7 +27,7 @@ public:
     bool loadTemplate(const std::string& name, const std::string& tmxPath);
     const POITemplate* getTemplate(const std::string& name) const;
     bool hasTemplate(const std::string& name) const;
-    void applyTemplateCollision(PointOfInterest* poi, const std::string& templateName);
+    void applyTemplateCollision(PointOfInterest* poi, const std::string& templateName) const;
 
 private:
     std::unordered_map<std::string, POITemplate> m_templates;
@@ -2,9 +2,9 @@
 #define POI_CONFIG_H
 
 #include <string>
-#include <unordered_map>
 #include <SFML/Graphics.hpp>
 #include "PointOfInterest.h"
+#include "EnumMap.h"
 
 /// <summary>
 /// POI TYPE CONFIG :
@@ -57,7 +57,7 @@ public:
 
 private:
     // Types and setups
-    std::unordered_map<PointOfInterest::Type, POITypeConfig> m_configs;
+    EnumMap<PointOfInterest::Type, POITypeConfig> m_configs;
 
     // This is used to Auto-Size POIs, was annoying to set them up each time, so just gets the size from a file
     sf::Vector2f parseSizeFromDefinition(const std::string& definitionPath) const;
@@ -58,6 +58,7 @@ public:
 
     // ========== State ==========
     bool isValid() const { return m_sprite.isValid(); }
+    const SpriteComponent& getSpriteComponent() const { return m_sprite; }
     PlayerState getCurrentState() const { return m_currentState; }
 
     // ========== Cursor ==========
@@ -38,6 +38,7 @@ public:
         Landmark,
         Farm,
         Quarry,
+        COUNT           // Total number of types
     };
 
     PointOfInterest(const std::string& name, Type type, const sf::Vector2f& worldPos, const sf::Vector2f& size);
@@ -0,0 +1,133 @@
+#ifndef POISSON_SAMPLER_HPP
+#define POISSON_SAMPLER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include <memory_resource>
+#include <random>
+#include <vector>
+#include "CollisionType.h"
+
+/// <summary>
+/// Bridson Poisson disk sampler shared by Voronoi sites, object placement and spawn points
+///
+/// - Spacing can vary across the domain: a density function returns 0..1 per position,
+///   1 packs points at minRadius, 0 spreads them out to maxRadius
+/// - Exclusion shapes (circles, rects, polygons) reject candidates inside them, e.g. the
+///   hideout ring or POI footprints
+/// - An optional accept function covers anything else (terrain, walkability). It filters
+///   rather than gates: candidates that don't become samples still seed a coarse exploration
+///   set at maxRadius spacing, so sampling keeps growing across ground nothing is accepted on
+///   and reaches every area of the domain
+/// - Output goes straight into the caller's vector, which doubles as the point store. The
+///   background grid, radii and active list are per call scratch from the same memory resource
+///   as the output, so a generation arena covers the whole run
+///
+/// Background grid cells are minRadius / sqrt(2) wide so each cell holds at most one point,
+/// neighbour search widens with maxRadius.
+/// </summary>
+class PoissonSampler
+{
+public:
+    struct Params
+    {
+        sf::FloatRect bounds;          // Sampling domain in world space
+        float minRadius = 32.f;        // Spacing where density is 1
+        float maxRadius = 32.f;        // Spacing where density is 0, same as minRadius = plain Bridson
+        int attemptsPerPoint = 30;     // k, candidates tried around an active point before it retires
+        size_t maxPoints = 0;          // Stop early once this many are placed, 0 = fill the domain
+    };
+
+    // 0..1 at a position, 1 = tightest spacing. Null = minRadius everywhere. Called for every
+    // candidate that gets past bounds and exclusions, even when min and max radius are the same
+    using DensityFunction = std::function<float(const sf::Vector2f&)>;
+
+    // Last check on a candidate that passed spacing and exclusions, false keeps it out of the
+    // output (it can still be explored from). Density has always been called for the same
+    // candidate just before, and a true here always becomes a sample, so the pair can share
+    // per candidate state
+    using AcceptFunction = std::function<bool(const sf::Vector2f&)>;
+
+    using PointList = std::pmr::vector<sf::Vector2f>;
+
+    PoissonSampler();
+    ~PoissonSampler() = default;
+
+    // ========== Exclusions ==========
+    // Kept until cleared, so one set can serve several sample() calls
+    void clearExclusions();
+    void addExclusionCircle(const sf::Vector2f& centre, float radius);
+    void addExclusionRect(const sf::FloatRect& rect);
+    void addExclusionPolygon(const CollisionPolygon& polygon);
+
+    bool isExcluded(const sf::Vector2f& pos) const;
+
+    // ========== Sampling ==========
+    // Clears out and fills it with the accepted points in placement order, returns the count.
+    // 0 means no valid first point was found in the domain. Scratch comes from out's resource
+    size_t sample(const Params& params, std::mt19937& rng, PointList& out,
+        const DensityFunction& density = nullptr,
+        const AcceptFunction& accept = nullptr);
+
+private:
+    // ========== Background Grid ==========
+    // Only lives for one sample() call
+    struct Scratch
+    {
+        explicit Scratch(std::pmr::memory_resource* resource)
+            : grid(resource)
+            , radii(resource)
+            , activeList(resource)
+            , exploreGrid(resource)
+            , explorePoints(resource)
+        {
+        }
+
+        std::pmr::vector<int> grid;         // Index into the output points, -1 = empty
+        std::pmr::vector<float> radii;      // Per point, parallel to the output
+        std::pmr::vector<int> activeList;   // Points that can still spawn neighbours, explore ones as ~index
+
+        // Candidates that didn't become samples, only with an accept function. Spaced maxRadius
+        // apart on their own coarse grid and never checked against samples, so they can't thin the output
+        std::pmr::vector<int> exploreGrid;
+        PointList explorePoints;
+    };
+
+    float radiusAt(const sf::Vector2f& pos, const Params& params, const DensityFunction& density) const;
+
+    // True if no existing point is within max(radius, its own radius) of pos
+    bool isFarEnough(const sf::Vector2f& pos, float radius, const Scratch& scratch, const PointList& points) const;
+
+    void insert(const sf::Vector2f& pos, float radius, Scratch& scratch, PointList& points);
+
+    int exploreCellIndex(const sf::Vector2f& pos) const;
+    bool isFarFromExplore(const sf::Vector2f& pos, const Scratch& scratch) const;
+    void insertExplore(const sf::Vector2f& pos, Scratch& scratch);
+
+    static bool polygonContains(const CollisionPolygon& polygon, const sf::Vector2f& pos);
+
+    sf::Vector2f m_origin;
+    float m_cellSize;
+    int m_gridWidth;
+    int m_gridHeight;
+    int m_searchCells;                 // Neighbourhood half-width in cells
+
+    // Explore grid, cell size maxRadius / sqrt(2) so the search is always 2 cells each way
+    float m_maxRadius;
+    float m_exploreCellSize;
+    int m_exploreGridWidth;
+    int m_exploreGridHeight;
+
+    // ========== Exclusions ==========
+    struct ExclusionCircle
+    {
+        sf::Vector2f centre;
+        float radiusSq;
+    };
+
+    std::vector<ExclusionCircle> m_circles;
+    std::vector<sf::FloatRect> m_rects;
+    std::vector<CollisionPolygon> m_polygons;
+};
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <array>
+#include <string>
+
+// ========== COMPILE TIME SWITCH ==========
+// Set THORNS_ENABLE_PROFILER=0 in project settings to strip every zone out of the build.
+#ifndef THORNS_ENABLE_PROFILER
+#define THORNS_ENABLE_PROFILER 1
+#endif
+
+/// <summary>
+/// Lightweight CPU frame profiler. PROFILE_ZONE("Name") times the enclosing scope, each zone is
+/// registered once (static local) so the hot path is just two clock reads and an atomic add.
+/// Per frame totals roll into a history ring for the overlay, and a capture of N frames can be
+/// exported as Chrome trace JSON (open in chrome://tracing or ui.perfetto.dev).
+/// </summary>
+namespace Profiler
+{
+    using ZoneId = int;
+
+    inline constexpr int MAX_ZONES = 64;
+    inline constexpr int HISTORY_FRAMES = 240;       // ~4 seconds at 60fps
+    inline constexpr int MAX_CAPTURE_EVENTS = 200000; // Hard cap so a long capture can't eat memory
+
+    // Summary of one zone over the history window, all times in milliseconds
+    struct ZoneStats
+    {
+        const char* name = "";
+        float lastMs = 0.f;     // Total time spent in the zone last frame
+        float avgMs = 0.f;
+        float maxMs = 0.f;
+        int lastCalls = 0;      // How many times it was entered last frame
+    };
+
+    // ========== Zones ==========
+
+    // Registers a zone name, only called once per PROFILE_ZONE site
+    ZoneId registerZone(const char* name);
+
+    // Nanoseconds on the profiler clock
+    long long nowNs();
+
+    // Adds a finished zone to this frame's totals (and the capture buffer if recording)
+    void recordZone(ZoneId id, long long startNs, long long endNs);
+
+    // ========== Frame ==========
+    void beginFrame();
+    void endFrame();
+
+    // ========== Queries ==========
+    int getZoneCount();
+    ZoneStats getZoneStats(ZoneId id);
+
+    // Frame times oldest -> newest, returns the index the newest frame was written to
+    int copyFrameHistory(std::array<float, HISTORY_FRAMES>& out);
+    float getAverageFrameMs();
+
+    // ========== Chrome Trace ==========
+
+    // Records every zone for the next frameCount frames then writes the JSON to filePath
+    bool beginCapture(int frameCount, const std::string& filePath);
+    bool isCapturing();
+
+    // ========== Scoped Zone ==========
+    class ScopedZone
+    {
+    public:
+        explicit ScopedZone(ZoneId id) : m_id(id), m_start(nowNs()) {}
+        ~ScopedZone() { recordZone(m_id, m_start, nowNs()); }
+
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+
+    private:
+        ZoneId m_id;
+        long long m_start;
+    };
+}
+
+// ========== MACROS ==========
+// "" name forces a string literal so zone names are fixed at compile time
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if THORNS_ENABLE_PROFILER
+#define PROFILE_ZONE(name)                                                                          \
+    static const Profiler::ZoneId PROFILE_CONCAT(profileZoneId_, __LINE__) = Profiler::registerZone("" name); \
+    const Profiler::ScopedZone PROFILE_CONCAT(profileZone_, __LINE__)(PROFILE_CONCAT(profileZoneId_, __LINE__))
+#else
+#define PROFILE_ZONE(name) do {} while (0)
+#endif
+
+#endif
+
+// ========== Personal Notes ==========
+// Zone totals are atomics so zones can be hit from more than one thread, the frame roll-up in
+// endFrame() swaps them back to 0. Capture events only take the mutex while a capture is running.
@@ -0,0 +1,58 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include "IUpdatable.h"
+#include "IRenderable.h"
+
+/// <summary>
+/// Debug panel for the Profiler. Shows the frame time graph for the history window and a table
+/// of every zone (last / avg / max ms and call count). Draw it with the UI view active.
+/// </summary>
+class ProfilerOverlay : public IUpdatable, public IRenderable
+{
+public:
+    ProfilerOverlay();
+    ~ProfilerOverlay() = default;
+
+    // ========== Initialization ==========
+    bool initialize(const std::string& fontPath);
+
+    // ========== IUpdatable ==========
+    // Rebuilds the text table a few times a second, not every frame
+    void update(sf::Time deltaTime) override;
+
+    // ========== IRenderable ==========
+    void render(sf::RenderTarget& target) const override;
+
+    // ========== Control ==========
+    void toggle() { m_visible = !m_visible; }
+    void setVisible(bool visible) { m_visible = visible; }
+    bool isVisible() const { return m_visible; }
+
+private:
+    void rebuildText();
+
+    // ========== State ==========
+    bool m_visible;
+    float m_refreshTimer;
+    std::string m_tableText;
+
+    // ========== Rendering ==========
+    sf::Font m_font;
+    bool     m_fontLoaded;
+
+    // ========== Layout (screen-space, UI view) ==========
+    static constexpr float PANEL_WIDTH = 520.f;
+    static constexpr float PANEL_LEFT_MARGIN = 20.f;
+    static constexpr float PANEL_TOP_MARGIN = 20.f;
+    static constexpr float GRAPH_HEIGHT = 80.f;
+    static constexpr float GRAPH_MAX_MS = 33.3f;          // Bars clamp at 30fps
+    static constexpr float FRAME_BUDGET_MS = 1000.f / 60.f;
+    static constexpr float REFRESH_INTERVAL = 0.25f;
+    static constexpr float LINE_HEIGHT = 18.f;
+    static constexpr unsigned int FONT_SIZE = 14u;
+};
+
+#endif
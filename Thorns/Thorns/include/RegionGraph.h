@@ -0,0 +1,144 @@
+#ifndef REGION_GRAPH_H
+#define REGION_GRAPH_H
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <vector>
+
+class Map;
+
+/// <summary>
+/// Per region summary of the Voronoi labelling, built in the same sweep that labels the tiles
+///
+/// - RegionInfo per region: tile count, tile bounds, centroid, its slice of the border tiles
+///   and its slice of the neighbour list
+/// - Neighbours carry the shared edge length (tile edges between the two regions), so the
+///   adjacency doubles as a weighted graph
+/// - Border tiles are the ones with a 4-neighbour in a different region
+///
+/// Tables are flat arrays with each region pointing at its slice, a query is an index and
+/// never touches the map. Region ids are the Voronoi site indices.
+///
+/// Building is split so the labelling jobs can feed it: each row band accumulates into its own
+/// Band, then finish() stitches the band seams and merges. build() does the whole thing from an
+/// already labelled map (snapshot restore).
+/// </summary>
+class RegionGraph
+{
+public:
+    struct RegionInfo
+    {
+        int tileCount = 0;
+        sf::IntRect tileBounds;         // Inclusive min, size in tiles
+        sf::Vector2f centroid;          // World space, mean of the tile centres
+        int borderBegin = 0;            // Slice of getBorderTiles()
+        int borderCount = 0;
+        int neighbourBegin = 0;         // Slice of getNeighbours()
+        int neighbourCount = 0;
+    };
+
+    struct Neighbour
+    {
+        int regionId = -1;
+        int sharedEdges = 0;            // Tile edges along the shared border
+    };
+
+    // Contiguous slice of one of the tables
+    template<typename T>
+    struct Range
+    {
+        const T* first = nullptr;
+        const T* last = nullptr;
+
+        const T* begin() const { return first; }
+        const T* end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+    };
+
+    RegionGraph();
+    ~RegionGraph() = default;
+
+    // ========== Building ==========
+    // Sizes the bands, bandCount is the most jobs the labelling can split into
+    void begin(int regionCount, int bandCount);
+
+    // Once a band's rows are labelled: tile stats, edges and border tiles inside [rowBegin, rowEnd).
+    // Only touches its own band, so different bands can run on different threads
+    void scanBand(const Map& map, int bandIndex, int rowBegin, int rowEnd);
+
+    // After every band: the seams between bands, then the merge into the tables
+    void finish(const Map& map);
+
+    // Full single threaded build over an already labelled map
+    void build(const Map& map, int regionCount);
+
+    void clear();
+
+    // ========== Queries ==========
+    int getRegionCount() const { return static_cast<int>(m_regions.size()); }
+    const RegionInfo* getRegion(int regionId) const;
+    const std::vector<RegionInfo>& getRegions() const { return m_regions; }
+
+    Range<sf::Vector2i> getBorderTiles(int regionId) const;
+    Range<Neighbour> getNeighbours(int regionId) const;
+
+    // Shared edge length between two regions, 0 when they don't touch
+    int getSharedEdges(int regionA, int regionB) const;
+
+private:
+    // ========== Band Accumulation ==========
+    // Everything one row band found, written by one job only
+    struct Accum
+    {
+        int tileCount = 0;
+        int minX = 0, minY = 0, maxX = 0, maxY = 0;
+        std::int64_t sumX = 0;
+        std::int64_t sumY = 0;
+    };
+
+    struct Band
+    {
+        std::vector<Accum> regions;
+        std::vector<std::uint64_t> borders;     // (region << 32) | tile index, may repeat
+        std::vector<std::uint32_t> edges;       // (low << 16) | high per shared tile edge
+        int rowBegin = 0;
+        int rowEnd = 0;
+        bool used = false;
+    };
+
+    // An edge between two labelled tiles in different regions, both tiles become border
+    static void addEdge(Band& band, int regionA, int tileA, int regionB, int tileB);
+    // Order independent pair key, region ids fit in 16 bits (site counts are in the tens)
+    static std::uint32_t edgeKey(int a, int b);
+
+    void merge(const Map& map);
+
+    std::vector<Band> m_bands;
+    Band m_seams;                       // Edges crossing band boundaries, found in finish()
+
+    std::vector<RegionInfo> m_regions;
+    std::vector<sf::Vector2i> m_borderTiles;
+    std::vector<Neighbour> m_neighbours;
+
+    // Merge scratch, kept so a regeneration doesn't allocate
+    std::vector<std::uint64_t> m_mergedBorders;
+    std::vector<std::uint32_t> m_mergedEdges;
+};
+
+#endif
+
+// Personal Notes Region Graph:
+/*
+    Why bands and not atomics: every tile would hit the same handful of per region counters
+    from every thread. Each band counting on its own and a merge of ~20 regions at the end is
+    nothing.
+
+    Seams: a band only reads its own rows (the rows below may still be getting labelled), so
+    the vertical edges between a band's last row and the next band's first row wait for
+    finish(). That's one row per band, not a second sweep.
+
+    Neighbours per region are stored both ways (A lists B and B lists A), the edge list is
+    sorted on (low, high) so both directions come out of the same run length pass.
+*/
@@ -0,0 +1,29 @@
+#ifndef RENDER_SNAPSHOT_H
+#define RENDER_SNAPSHOT_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+/// <summary>
+/// Everything the main thread needs to draw the world for one frame, copied out of the sim
+/// at the end of its ticks. Sprites are copied by value (position, rotation, scale, texture
+/// rect and a texture pointer) so the sim can keep moving entities while this is drawn.
+/// Textures are owned by the entities/pools and live for the whole game, so the pointers stay good.
+/// PN: Vectors are cleared not freed, after the first few frames capturing doesn't allocate.
+/// </summary>
+struct RenderSnapshot
+{
+    sf::View gameView;                  // Camera at the time of capture
+    std::vector<sf::Sprite> items;      // World items inside the camera
+    std::vector<sf::Sprite> entities;   // Player then enemies, drawn in this order
+    bool valid = false;                 // False until the first capture
+
+    void clear()
+    {
+        items.clear();
+        entities.clear();
+        valid = false;
+    }
+};
+
+#endif
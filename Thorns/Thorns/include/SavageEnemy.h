@@ -1,7 +1,7 @@
 #ifndef SAVAGE_ENEMY_H
 #define SAVAGE_ENEMY_H
 
-#include "SpriteComponent.h"
+#include "SpriteView.h"
 #include "IEnemy.h"
 #include <SFML/System/Time.hpp>
 
@@ -23,7 +23,8 @@ public:
     ~SavageEnemy() = default;
 
     // ========== Initialization ==========
-    bool initialize(const std::string& atlasPath);
+    // Atlas is owned by EnemyManager, shared by every pool slot
+    bool initialize(const sf::Texture& atlas);
 
     // ========== IUpdatable ==========
     void update(sf::Time deltaTime) override;
@@ -50,6 +51,7 @@ public:
     // ========== Queries ==========
     AIState getAIState() const { return m_aiState; }
     bool canSeePlayer() const { return m_aiState == AIState::Chase; }
+    const SpriteView& getSpriteView() const { return m_sprite; }
 
 
     void takeDamage(float amount);
@@ -59,7 +61,7 @@ private:
     void updateMovement(sf::Time deltaTime);
     void faceDirection(const sf::Vector2f& direction);
 
-    SpriteComponent m_sprite;
+    SpriteView      m_sprite;
     bool            m_active;
 
     AIState         m_aiState;
@@ -79,4 +81,4 @@ private:
     static constexpr float SPRITE_NORTH_OFFSET = 90.f;
 };
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef SIMULATION_WORKER_H
+#define SIMULATION_WORKER_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/// <summary>
+/// One background thread that runs a fixed job each time it is kicked. Game uses it to step
+/// the simulation while the main thread is drawing the previous frame's snapshot.
+/// kick() and wait() are always paired from the same (main) thread, there is never more than
+/// one job in flight so a mutex + condition variable is all it needs.
+/// </summary>
+class SimulationWorker
+{
+public:
+    SimulationWorker();
+    ~SimulationWorker();
+
+    SimulationWorker(const SimulationWorker&) = delete;
+    SimulationWorker& operator=(const SimulationWorker&) = delete;
+
+    // ========== Lifetime ==========
+    // Job is set once here so kicking a frame never allocates
+    void start(std::function<void()> job);
+    void stop();
+
+    // ========== Per Frame ==========
+    void kick();    // Run the job once on the worker
+    void wait();    // Block until that run has finished
+
+    bool isRunning() const { return m_thread.joinable(); }
+
+private:
+    void threadMain();
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_kickCondition;
+    std::condition_variable m_doneCondition;
+    std::function<void()> m_job;
+
+    bool m_pending;     // Kicked, not picked up yet
+    bool m_busy;        // Job running
+    bool m_quit;
+};
+
+#endif
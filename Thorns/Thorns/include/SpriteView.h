@@ -0,0 +1,71 @@
+#ifndef SPRITE_VIEW_HPP
+#define SPRITE_VIEW_HPP
+
+#include <SFML/Graphics.hpp>
+#include "IRenderable.h"
+#include "IPositionable.h"
+
+/// <summary>
+/// Non-owning sprite: a texture handle, a rect into it and a transform
+/// For the shared atlas case (items, inventory icons, enemies), the texture lives in whoever
+/// loaded it once (WorldItemPool, EnemyManager) and must outlive the view
+///
+/// SpriteComponent is still the owning version, for things with their own file (Player, POIs)
+/// PN: sf::Sprite is only built when drawing or capturing, so no empty sf::Texture is carried around
+/// </summary>
+class SpriteView : public IRenderable, public IPositionable
+{
+public:
+    SpriteView();
+    ~SpriteView() = default;
+
+    // ========== Texture ==========
+    // Points at a region of a texture owned elsewhere, scaled to width x height
+    bool setTexture(const sf::Texture& texture, float width, float height, const sf::IntRect& textureRect);
+
+    // ========== IRenderable ==========
+    void render(sf::RenderTarget& target) const override;
+
+    // ========== IPositionable ==========
+    void setPosition(const sf::Vector2f& pos) override;
+    sf::Vector2f getPosition() const override;
+
+    // ========== Rotation ==========
+    void setRotation(sf::Angle angle);
+    sf::Angle getRotation() const;
+
+    // ========== Origin ==========
+    void setOrigin(const sf::Vector2f& origin);
+    void centerOrigin();
+
+    // ========== Size/Scale ==========
+    void setSize(float width, float height);
+    sf::Vector2f getSize() const;
+    void setScale(const sf::Vector2f& scale);
+
+    // ========== Movement ==========
+    void move(const sf::Vector2f& offset);
+
+    // ========== Texture Rect (for animation) ==========
+    void setTextureRect(const sf::IntRect& rect);
+    sf::IntRect getTextureRect() const { return m_textureRect; }
+
+    // ========== Collision ==========
+    sf::FloatRect getBounds() const;
+    sf::FloatRect getLocalBounds() const;
+
+    // ========== Validation ==========
+    bool isValid() const { return m_texture != nullptr; }
+
+    // ========== Getters ==========
+    // Built on demand, only call when isValid()
+    sf::Sprite getSprite() const;
+
+private:
+    const sf::Texture* m_texture;   // Non-owning, null until setTexture
+    sf::IntRect m_textureRect;
+    sf::Transformable m_transform;
+    sf::Vector2f m_targetSize;
+};
+
+#endif
@@ -2,9 +2,11 @@
 #define VORONOI_DIAGRAM_HPP
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory_resource>
 #include <vector>
 #include <random>
-#include <unordered_map>
+#include "PoissonSampler.h"
 
 class Map;
 class PointOfInterest;
@@ -25,12 +27,24 @@ struct VoronoiSite
         , tileCoords(coords)
         , regionId(id)
         , hasPOI(false)
-        , debugColor(sf::Color(
-            rand() % 156 + 100,  // R: 100-255
-            rand() % 156 + 100,  // G: 100-255
-            rand() % 156 + 100   // B: 100-255
-        ))
+        , debugColor(colorFor(coords, id))
     {}
+
+    // Hashed from the site itself so the colour is the same every run and no global rand() is touched
+    static sf::Color colorFor(const sf::Vector2i& coords, int id)
+    {
+        std::uint32_t hash = static_cast<std::uint32_t>(coords.x) * 73856093u
+            ^ static_cast<std::uint32_t>(coords.y) * 19349663u
+            ^ static_cast<std::uint32_t>(id) * 83492791u;
+        hash ^= hash >> 15;
+        hash *= 0x2c1b3c6du;
+        hash ^= hash >> 12;
+
+        return sf::Color(
+            static_cast<std::uint8_t>(100 + (hash & 0xFF) % 156),          // R: 100-255
+            static_cast<std::uint8_t>(100 + ((hash >> 8) & 0xFF) % 156),   // G: 100-255
+            static_cast<std::uint8_t>(100 + ((hash >> 16) & 0xFF) % 156)); // B: 100-255
+    }
 };
 
 /// <summary>
@@ -48,8 +62,9 @@ public:
     // Add site to grid
     void addSite(int siteIndex, const sf::Vector2f& position);
 
-    // Get sites near a position (returns indices into VoronoiDiagram::m_sites)
-    std::vector<int> getNearbySites(const sf::Vector2f& position) const;
+    // Sites in the 3x3 cells around a position, as indices into VoronoiDiagram::m_sites.
+    // Clears out first, the caller owns the buffer so hot loops can reuse one
+    void getNearbySites(const sf::Vector2f& position, std::pmr::vector<int>& out) const;
 
 private:
     float m_cellSize;
@@ -58,8 +73,12 @@ private:
     float m_worldWidth;
     float m_worldHeight;
 
-    // Hash grid: (gridX, gridY) -> list of site indices
-    std::unordered_map<int, std::vector<int>> m_cells;
+    // Flat grid, each cell is a list of sites threaded through m_siteNext (-1 = end).
+    // Appends at the tail so a cell lists its sites in insertion order, vectors keep their
+    // capacity between generations
+    std::vector<int> m_cellHeads;
+    std::vector<int> m_cellTails;
+    std::vector<int> m_siteNext;
 
     // Convert world position to grid coordinates
     sf::Vector2i worldToGrid(const sf::Vector2f& position) const;
@@ -75,6 +94,9 @@ private:
 class VoronoiDiagram
 {
 public:
+    // Sites are never placed (or relaxed) closer than this to the hideout
+    static constexpr float HIDEOUT_EXCLUSION = 400.f;
+
     VoronoiDiagram();
     ~VoronoiDiagram() = default;
 
@@ -83,7 +105,7 @@ public:
     // Map to be passed, number of sites and the seed used for generation for next map generation
     // *Note: Respects Hideout position in the generation for min spacing 
     // ========== Poisson Disk Sampling ==========
-    // Generate evenly-spaced sites using Bridson's algorithm
+    // Generate evenly-spaced sites using Bridson's algorithm (PoissonSampler)
     void generateSitesPoisson(Map* map, unsigned char numSites,
         const sf::Vector2f& hideoutPos,
         float minSiteDistance, std::mt19937& rng);
@@ -108,10 +130,21 @@ public:
     }
 
     // Get nearby sites for a position (exposed for single-pass)
-    std::vector<int> getNearbySites(const sf::Vector2f& position) const
+    void getNearbySites(const sf::Vector2f& position, std::pmr::vector<int>& out) const
     {
-        return m_spatialGrid.getNearbySites(position);
+        m_spatialGrid.getNearbySites(position, out);
     }
+
+    // ========== Lloyd Relaxation ==========
+    // Moves each site to its target (its region's centroid), snapped to a tile centre. A site
+    // stays put if the target is a POI tile or inside the hideout exclusion.
+    // Writes how far each site moved, rebuilds the spatial grid and returns the largest move
+    float relaxSites(const Map& map, const std::pmr::vector<sf::Vector2f>& targets,
+        const sf::Vector2f& hideoutPos, float cellSize, std::pmr::vector<float>& displacement);
+
+    // Per generation temporaries (the Poisson buffers) come from here, null = the default heap.
+    // Non-owning, the generator's arena
+    void setScratchResource(std::pmr::memory_resource* resource) { m_scratch = resource; }
     
     // ========== Queries ==========
     // Find closest site to a world position
@@ -122,26 +155,27 @@ public:
 
     // Mark site as a POI
     void markSiteWithPOI(int siteID);
+
+    // Replace the sites with ones loaded from a snapshot, rebuilds the spatial grid from them
+    void restoreSites(std::vector<VoronoiSite>&& sites, float worldWidth, float worldHeight, float cellSize);
     
     // ========== Debug ==========
+    // Draws the cached site markers, one draw call for all of them
     void renderDebug(sf::RenderTarget& target) const;
 
+    // Rebuilds the marker geometry from the current sites. The generator calls it once the
+    // sites are final for this map, anything that moves them after has to call it again
+    void buildDebugGeometry();
+
     // ========== Wipe Old Data ==========
     void clear()
     {
         m_sites.clear();
         m_spatialGrid.clear();
-        m_poissonGrid.clear();
-        m_activeList.clear();
+        m_debugMarkers.clear();
     }
 
 private:
-    // ========== Poisson Disk Sampling ==========
-    // Helper: Check if position is valid for new site
-    bool isValidSitePositionPoisson(const sf::Vector2f& pos,
-        const sf::Vector2f& hideoutPos,
-        float minDist, float hideoutExclusion) const;
-
     // ========== Rejection Sampling ==========
     // Check if position is valid for site placement
     bool isValidSitePosition(const sf::Vector2f& pos, const sf::Vector2f& hideoutPos, 
@@ -161,9 +195,16 @@ private:
     SpatialGrid m_spatialGrid;
     Map* m_map;  // Non-owning pointer to map being processed
 
-    // Poisson dusk sampling temp stoages
-    mutable std::vector<sf::Vector2f> m_poissonGrid;
-    mutable std::vector<sf::Vector2f> m_activeList;
+    // Poisson sampling, the points and the sampler's grid are scratch from m_scratch
+    PoissonSampler m_sampler;
+    std::pmr::memory_resource* m_scratch = nullptr;
+
+    // ========== Debug Markers ==========
+    static constexpr int MARKER_SEGMENTS = 16;
+    static constexpr float MARKER_RADIUS = 8.f;
+    static constexpr float MARKER_OUTLINE = 2.f;
+
+    sf::VertexArray m_debugMarkers{ sf::PrimitiveType::Triangles };  // Fill + outline ring per site
 };
 
 #endif
@@ -201,4 +242,4 @@ private:
 // Personal Notes Poisson Sampling and Spatial Partition:
 /*
     // Video Url for Poisson example: https://youtu.be/jofUe3Kjag4?si=HnIRv3t2Yv7CT_Gq
-*/
\ No newline at end of file
+*/
\ No newline at end of file
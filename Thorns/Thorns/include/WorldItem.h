@@ -5,7 +5,7 @@
 #include "IRenderable.h"
 #include "IPositionable.h"
 #include "ICollidable.h"
-#include "SpriteComponent.h"
+#include "SpriteView.h"
 #include "ItemType.h"
 
 // ========== WORLD ITEM ==========
@@ -43,14 +43,15 @@ public:
 
     // ========== Queries ==========
     ItemType getType() const { return m_type; }
+    const SpriteView& getSpriteView() const { return m_sprite; }
 
 private:
     ItemType        m_type;
     sf::Vector2f    m_worldPosition;
-    SpriteComponent m_sprite;
+    SpriteView      m_sprite;
     bool            m_active;
 
     float           m_pickupRadius;
 };
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
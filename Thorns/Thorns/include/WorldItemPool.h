@@ -38,6 +38,9 @@ public:
     // Renders all active items with the frustum culling.
     void render(sf::RenderTarget& target, const sf::View& view) const;
 
+    // Same culling as render(), but copies the sprites out for the threaded render snapshot
+    void captureSprites(std::vector<sf::Sprite>& out, const sf::View& view) const;
+
     // ========== Queries ==========
 
     // Returns non-owning pointers to all currently active items.
@@ -56,4 +59,4 @@ private:
     bool m_atlasLoaded;
 };
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -1,12 +1,11 @@
 #ifndef WORLD_OBJECT_HPP
 #define WORLD_OBJECT_HPP
 
-#include <SFML/Graphics.hpp>
-#include <string>
-#include "SpriteComponent.h"
-#include "IRenderable.h"
-#include "IPositionable.h"
-#include "ICollidable.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 #include "CollisionType.h"
 
 /// <summary>
@@ -14,14 +13,16 @@
 /// These are decorative objects generated using Perlin noise
 /// 
 /// Design:
-/// - Lightweight: Only stores position and sprite reference
-/// - Batched rendering: Multiple objects share same texture atlas
+/// - Compact record: type, position, half size and the shared shape table, 32 bytes
+/// - No sprite, no vtable, no heap: ObjectPlacer keeps them by value in one contiguous vector
+/// - The type is the atlas index, sprites are only built as quads for the visible objects
+///   when ObjectPlacer batches them into one vertex array
 /// </summary>
-class WorldObject : public IRenderable, public IPositionable, public ICollidable
+class WorldObject
 {
 public:
     // Object type determines sprite and placement rules
-    enum class Type
+    enum class Type : std::uint8_t
     {
         SmallRoot,      // Small tree roots (testing)
         TreeTop1,       // Tree canopy variant 1
@@ -31,27 +32,26 @@ public:
         COUNT           // Total number of types
     };
 
-    WorldObject(Type type, const sf::Vector2f& worldPos);
-    ~WorldObject() = default;
+    // size is the rendered size, the object is centred on worldPos like the sprite was
+    WorldObject(Type type, const sf::Vector2f& worldPos, const sf::Vector2f& size,
+        const std::vector<CollisionShape>* shapes = nullptr);
 
-    // ========== IRenderable ==========
-    void render(sf::RenderTarget& target) const override;
+    // ========== Position ==========
+    sf::Vector2f getPosition() const { return m_worldPosition; }
+    void setPosition(const sf::Vector2f& pos) { m_worldPosition = pos; }
 
-    // ========== IPositionable ==========
-    sf::Vector2f getPosition() const override { return m_worldPosition; }
-    void setPosition(const sf::Vector2f& pos) override;
-
-    // ========== ICollidable ==========
-    void addCollisionShape(const CollisionShape& shape);
-    void clearCollisionShapes();
-
-    // ICollidable implementation
-    sf::FloatRect getBounds() const override;
+    // ========== Bounds ==========
+    // Rendered area, also the broad phase box for collision
+    sf::FloatRect getBounds() const
+    {
+        return sf::FloatRect(m_worldPosition - m_halfSize, m_halfSize * 2.f);
+    }
 
-    // ========== Configuration ==========
-    bool loadSpriteFromTexture(const sf::Texture& sharedTexture, const sf::IntRect& textureRect, const sf::Vector2f& size);
+    sf::Vector2f getSize() const { return m_halfSize * 2.f; }
 
-    void setCollisionShapes(const std::vector<CollisionShape>* shapes, const sf::Vector2f& templateOrigin);
+    // ========== Collision ==========
+    // Shapes are template space, offset by the object's position
+    void setCollisionShapes(const std::vector<CollisionShape>* shapes) { m_collisionShapes = shapes; }
 
     bool hasCollisionShapes() const { return m_collisionShapes != nullptr && !m_collisionShapes->empty(); }
 
@@ -59,17 +59,15 @@ public:
 
     // ========== Queries ==========
     Type getType() const { return m_type; }
-    bool isValid() const;
 
 private:
-    Type m_type;
-    sf::Vector2f m_worldPosition;
-    std::unique_ptr<SpriteComponent> m_sprite;
-
     // Non-owning pointer to the Flyweight shape table (null = no collision)
-    const std::vector<CollisionShape>* m_collisionShapes = nullptr;
-
-    sf::Vector2f m_shapeOffset;
+    const std::vector<CollisionShape>* m_collisionShapes;
+    sf::Vector2f m_worldPosition;
+    sf::Vector2f m_halfSize;
+    Type m_type;
 };
 
+static_assert(std::is_trivially_copyable_v<WorldObject>, "WorldObject is stored by value in bulk, keep it POD");
+
 #endif
\ No newline at end of file
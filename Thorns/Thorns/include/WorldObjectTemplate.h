@@ -3,12 +3,13 @@
 
 #include <SFML/Graphics.hpp>
 #include <tmxlite/Map.hpp>
+#include <memory>
 #include <vector>
 #include <string>
-#include <unordered_map>
 #include <variant>
 #include "WorldObject.h"
 #include "CollisionType.h"
+#include "EnumMap.h"
 
 // Stores collision shapes for one named object type, in template-local space
 struct WorldObjectTemplate
@@ -28,6 +29,10 @@ public:
     // Load all collision shapes from a single TMX file
     bool loadTemplates(const std::string& tmxPath);
 
+    // Parsed once per path and handed out read-only, every ObjectPlacer shares the same copy.
+    // Safe to call from several threads, null if the file couldn't be loaded
+    static std::shared_ptr<const WorldObjectTemplateManager> loadShared(const std::string& tmxPath);
+
     const std::vector<CollisionShape>* getShapes(WorldObject::Type type) const;
 
     bool hasShapes(WorldObject::Type type) const;
@@ -38,7 +43,7 @@ private:
 
     static bool buildShape(const tmx::Object& obj, CollisionShape& outShape);
 
-    std::unordered_map<WorldObject::Type, std::vector<CollisionShape>> m_shapes;
+    EnumMap<WorldObject::Type, std::vector<CollisionShape>> m_shapes;
 
 };
 
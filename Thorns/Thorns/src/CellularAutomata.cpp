@@ -0,0 +1,241 @@
+#include "CellularAutomata.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+
+namespace
+{
+    // Full adder on 64 lanes at once
+    inline void fullAdd(std::uint64_t a, std::uint64_t b, std::uint64_t c,
+        std::uint64_t& sum, std::uint64_t& carry)
+    {
+        const std::uint64_t ab = a ^ b;
+        sum = ab ^ c;
+        carry = (a & b) | (c & ab);
+    }
+
+    // Lanes whose 4-bit count (ones, twos, fours, eights) equals n
+    inline std::uint64_t countEquals(int n, std::uint64_t ones, std::uint64_t twos,
+        std::uint64_t fours, std::uint64_t eights)
+    {
+        return ((n & 1) ? ones : ~ones)
+            & ((n & 2) ? twos : ~twos)
+            & ((n & 4) ? fours : ~fours)
+            & ((n & 8) ? eights : ~eights);
+    }
+}
+
+CellularAutomata::CellularAutomata()
+    : m_width(0)
+    , m_height(0)
+    , m_wordsPerRow(0)
+    , m_lastWordMask(0)
+{
+}
+
+// ========== Setup ==========
+void CellularAutomata::resize(int width, int height)
+{
+    m_width = std::max(0, width);
+    m_height = std::max(0, height);
+    m_wordsPerRow = (m_width + 63) / 64;
+
+    const int usedBits = m_width % 64;
+    m_lastWordMask = (usedBits == 0) ? ~0ULL : ((1ULL << usedBits) - 1ULL);
+
+    const size_t wordCount = static_cast<size_t>(m_wordsPerRow) * m_height;
+    m_front.assign(wordCount, 0ULL);
+    m_back.assign(wordCount, 0ULL);
+    m_open.assign(wordCount, ~0ULL);
+
+    // Padding past the right edge is never open, so it can never come alive
+    if (m_wordsPerRow > 0)
+    {
+        for (int y = 0; y < m_height; ++y)
+            m_open[static_cast<size_t>(y) * m_wordsPerRow + m_wordsPerRow - 1] = m_lastWordMask;
+    }
+}
+
+void CellularAutomata::clear()
+{
+    resize(m_width, m_height);
+}
+
+void CellularAutomata::setCell(int x, int y, bool alive)
+{
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height)
+        return;
+
+    std::uint64_t& word = m_front[static_cast<size_t>(y) * m_wordsPerRow + (x >> 6)];
+    const std::uint64_t bit = 1ULL << (x & 63);
+
+    if (alive)
+        word |= bit;
+    else
+        word &= ~bit;
+}
+
+bool CellularAutomata::getCell(int x, int y) const
+{
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height)
+        return false;
+
+    const std::uint64_t word = m_front[static_cast<size_t>(y) * m_wordsPerRow + (x >> 6)];
+    return (word >> (x & 63)) & 1ULL;
+}
+
+void CellularAutomata::setLocked(int x, int y, bool locked)
+{
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height)
+        return;
+
+    const size_t index = static_cast<size_t>(y) * m_wordsPerRow + (x >> 6);
+    const std::uint64_t bit = 1ULL << (x & 63);
+
+    if (locked)
+    {
+        m_open[index] &= ~bit;
+        m_front[index] &= ~bit;
+    }
+    else
+    {
+        m_open[index] |= bit;
+    }
+}
+
+// ========== Simulation ==========
+void CellularAutomata::stepRows(const Rules& rules, int rowBegin, int rowEnd)
+{
+    const int words = m_wordsPerRow;
+
+    for (int y = rowBegin; y < rowEnd; ++y)
+    {
+        // Rows outside the map read as all dead
+        const std::uint64_t* rows[3] = {
+            (y > 0) ? &m_front[static_cast<size_t>(y - 1) * words] : nullptr,
+            &m_front[static_cast<size_t>(y) * words],
+            (y + 1 < m_height) ? &m_front[static_cast<size_t>(y + 1) * words] : nullptr
+        };
+
+        std::uint64_t* out = &m_back[static_cast<size_t>(y) * words];
+        const std::uint64_t* open = &m_open[static_cast<size_t>(y) * words];
+
+        for (int k = 0; k < words; ++k)
+        {
+            // West/east planes for each of the three rows, edge bits carried from the next word
+            std::uint64_t centre[3], west[3], east[3];
+            for (int r = 0; r < 3; ++r)
+            {
+                const std::uint64_t* row = rows[r];
+                const std::uint64_t c = row ? row[k] : 0ULL;
+                const std::uint64_t prev = (row && k > 0) ? row[k - 1] : 0ULL;
+                const std::uint64_t next = (row && k + 1 < words) ? row[k + 1] : 0ULL;
+
+                centre[r] = c;
+                west[r] = (c << 1) | (prev >> 63);
+                east[r] = (c >> 1) | (next << 63);
+            }
+
+            // 8 neighbour planes -> ones, twos, fours, eights
+            std::uint64_t sA, cA, sB, cB, ones, cD;
+            fullAdd(west[0], centre[0], east[0], sA, cA);
+            fullAdd(west[2], centre[2], east[2], sB, cB);
+
+            const std::uint64_t sC = west[1] ^ east[1];
+            const std::uint64_t cC = west[1] & east[1];
+            fullAdd(sA, sB, sC, ones, cD);
+
+            std::uint64_t sE, foursA;
+            fullAdd(cA, cB, cC, sE, foursA);
+            const std::uint64_t twos = sE ^ cD;
+            const std::uint64_t foursB = sE & cD;
+
+            const std::uint64_t fours = foursA ^ foursB;
+            const std::uint64_t eights = foursA & foursB;
+
+            std::uint64_t born = 0ULL;
+            std::uint64_t survives = 0ULL;
+            for (int n = 0; n <= 8; ++n)
+            {
+                const bool inBirth = (rules.birthMask >> n) & 1u;
+                const bool inSurvival = (rules.survivalMask >> n) & 1u;
+                if (!inBirth && !inSurvival)
+                    continue;
+
+                const std::uint64_t match = countEquals(n, ones, twos, fours, eights);
+                if (inBirth) born |= match;
+                if (inSurvival) survives |= match;
+            }
+
+            const std::uint64_t alive = centre[1];
+            out[k] = ((alive & survives) | (~alive & born)) & open[k];
+        }
+    }
+}
+
+void CellularAutomata::step(const Rules& rules, unsigned int threadCount)
+{
+    PROFILE_ZONE("CellularAutomata::step");
+
+    if (m_wordsPerRow == 0 || m_height == 0)
+        return;
+
+    if (threadCount == 0)
+        threadCount = JobSystem::getThreadCount();
+
+    // Enough work per band to be worth a thread, otherwise stay on this one
+    const int totalWords = m_wordsPerRow * m_height;
+    const int maxBands = std::max(1, totalWords / MIN_WORDS_PER_BAND);
+    const int bandCount = std::min({ static_cast<int>(threadCount), maxBands, m_height });
+
+    if (bandCount <= 1)
+    {
+        stepRows(rules, 0, m_height);
+    }
+    else
+    {
+        // Bands only read m_front and write their own rows of m_back, no locking needed.
+        // Grain of a band keeps the job count at bandCount, the calling thread helps out
+        const int rowsPerBand = (m_height + bandCount - 1) / bandCount;
+
+        JobSystem::parallelFor(0, m_height, rowsPerBand, [this, &rules](int begin, int end)
+        {
+                stepRows(rules, begin, end);
+        });
+    }
+
+    m_front.swap(m_back);
+}
+
+void CellularAutomata::run(const Rules& rules, int iterations, unsigned int threadCount)
+{
+    for (int i = 0; i < iterations; ++i)
+        step(rules, threadCount);
+}
+
+// ========== Queries ==========
+int CellularAutomata::countAlive() const
+{
+    int count = 0;
+    for (std::uint64_t word : m_front)
+    {
+        // Kernighan popcount, C++17 has no std::popcount
+        while (word)
+        {
+            word &= word - 1ULL;
+            ++count;
+        }
+    }
+    return count;
+}
+
+std::uint16_t CellularAutomata::makeMask(const char* digits)
+{
+    std::uint16_t mask = 0;
+    for (const char* c = digits; c && *c; ++c)
+    {
+        if (*c >= '0' && *c <= '8')
+            mask |= static_cast<std::uint16_t>(1u << (*c - '0'));
+    }
+    return mask;
+}
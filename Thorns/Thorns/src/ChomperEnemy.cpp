@@ -2,6 +2,7 @@
 #include "LineOfSight.h"
 #include "MathUtilities.h"
 #include "AssetPaths.h"
+#include "Logger.h"
 #include "Map.h"
 #include <iostream>
 #include <cmath>
@@ -18,9 +19,9 @@ ChomperEnemy::ChomperEnemy()
 {
 }
 
-bool ChomperEnemy::initialize(const std::string& atlasPath)
+bool ChomperEnemy::initialize(const sf::Texture& atlas)
 {
-    if (!m_sprite.loadTexture(atlasPath, 64.f, 64.f,
+    if (!m_sprite.setTexture(atlas, 64.f, 64.f,
         sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(64, 64))))
         return false;
 
@@ -77,7 +78,7 @@ void ChomperEnemy::updateAI(const sf::Vector2f& playerPos, const Map* map)
         if (canSee)
         {
             m_aiState = AIState::Chase;
-            std::cout << "ChomperEnemy: Chase\n";
+            LOG_DEBUG(AI, "ChomperEnemy: Chase");
         }
         break;
 
@@ -87,7 +88,7 @@ void ChomperEnemy::updateAI(const sf::Vector2f& playerPos, const Map* map)
         {
             m_aiState = AIState::Lost;
             m_lostTimer = 0.f;
-            std::cout << "ChomperEnemy: Lost\n";
+            LOG_DEBUG(AI, "ChomperEnemy: Lost");
             break;
         }
 
@@ -125,7 +126,7 @@ void ChomperEnemy::updateAI(const sf::Vector2f& playerPos, const Map* map)
             m_aiState = AIState::Chase;
             m_velocity = sf::Vector2f(0.f, 0.f);
             m_leapCooldownTimer = LEAP_COOLDOWN;
-            std::cout << "ChomperEnemy: Leap finished, back to Chase\n";
+            LOG_DEBUG(AI, "ChomperEnemy: Leap finished, back to Chase");
         }
         break;
     }
@@ -144,7 +145,7 @@ void ChomperEnemy::updateAI(const sf::Vector2f& playerPos, const Map* map)
         {
             m_aiState = AIState::Idle;
             m_velocity = sf::Vector2f(0.f, 0.f);
-            std::cout << "ChomperEnemy: Idle\n";
+            LOG_DEBUG(AI, "ChomperEnemy: Idle");
             break;
         }
 
@@ -191,7 +192,7 @@ void ChomperEnemy::beginLeap(const sf::Vector2f& targetPos)
     m_aiState = AIState::Leap;
 
     faceDirection(dir);
-    std::cout << "ChomperEnemy: Leap!\n";
+    LOG_DEBUG(AI, "ChomperEnemy: Leap!");
 }
 
 
@@ -221,5 +222,5 @@ void ChomperEnemy::takeDamage(float amount)
 {
     // Simple one-shot kill for now; expand with HealthComponent when ready
     m_active = false;
-    std::cout << "SavageEnemy killed\n";
-}
\ No newline at end of file
+    LOG_INFO(AI, "ChomperEnemy killed");
+}
\ No newline at end of file
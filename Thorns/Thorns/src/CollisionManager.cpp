@@ -2,6 +2,9 @@
 #include "Map.h"
 #include "PointOfInterest.h"
 #include "WorldObject.h"
+#include "Profiler.h"
+#include "JobSystem.h"
+#include <atomic>
 #include <cmath>
 #include <algorithm>
 
@@ -23,6 +26,8 @@ bool CollisionManager::checkWorldCollision(const sf::FloatRect& entityBounds, co
 CollisionManager::CollisionResult CollisionManager::checkWorldCollisionDetailed(
     const sf::FloatRect& entityBounds, const Map* map) const
 {
+    PROFILE_ZONE("Collision::world");
+
     CollisionResult result{ false, sf::Vector2f(0.f, 0.f), nullptr };
     if (!map) return result;
 
@@ -75,7 +80,8 @@ CollisionManager::CollisionResult CollisionManager::checkWorldCollisionDetailed(
                     if constexpr (std::is_same_v<T, sf::FloatRect>)
                         return entityBounds.findIntersection(s).has_value();
                     else if constexpr (std::is_same_v<T, CollisionPolygon>)
-                        return aabbVsPolygon(entityBounds, s.points);
+                        return entityBounds.findIntersection(s.bounds).has_value()
+                            && aabbVsPolygon(entityBounds, s.points);
                     return false;
             }, shapes[idx]);
 
@@ -268,59 +274,99 @@ sf::Vector2f CollisionManager::getMTVPolygon(const sf::FloatRect& box,
 // WorldObject overload: uses TMX-loaded shapes for narrow phase when available
 CollisionManager::CollisionResult CollisionManager::checkCollisionWith(
     const sf::FloatRect& entityBounds,
-    const std::vector<std::unique_ptr<WorldObject>>& objects) const
+    const std::vector<WorldObject>& objects) const
 {
+    PROFILE_ZONE("Collision::objects");
+
     CollisionResult result{ false, sf::Vector2f(0.f, 0.f), nullptr };
+    const int objectCount = static_cast<int>(objects.size());
 
-    for (const auto& obj : objects)
+    // Small lists aren't worth the jobs
+    if (objectCount <= OBJECTS_PER_JOB)
     {
-        // Broad-phase: skip if sprite AABB doesn't intersect
-        if (!entityBounds.findIntersection(obj->getBounds()).has_value())
-            continue;
-
-        if (obj->hasCollisionShapes())
+        for (const auto& obj : objects)
         {
-            const auto worldShapes = obj->getWorldSpaceShapes();
+            if (testObject(entityBounds, obj, result))
+                return result;
+        }
+        return result;
+    }
+
+    // Chunks race to the lowest hit index, so the object reported is the same one the
+    // serial loop would find. Chunks past the current best stop early
+    std::atomic<int> firstHit{ objectCount };
 
-            for (const auto& shape : worldShapes)
+    JobSystem::parallelFor(0, objectCount, OBJECTS_PER_JOB, [&](int begin, int end)
+    {
+            CollisionResult scratch{ false, sf::Vector2f(0.f, 0.f), nullptr };
+            for (int i = begin; i < end && i < firstHit.load(std::memory_order_relaxed); ++i)
             {
-                bool hit = std::visit([&](const auto& s) -> bool
-                    {
-                        using T = std::decay_t<decltype(s)>;
-                        if constexpr (std::is_same_v<T, sf::FloatRect>)
-                            return entityBounds.findIntersection(s).has_value();
-                        else if constexpr (std::is_same_v<T, CollisionPolygon>)
-                            return aabbVsPolygon(entityBounds, s.points);
-                        return false;
-                    }, shape);
-
-                if (hit)
+                if (!testObject(entityBounds, objects[i], scratch))
+                    continue;
+
+                int best = firstHit.load(std::memory_order_relaxed);
+                while (i < best && !firstHit.compare_exchange_weak(best, i, std::memory_order_relaxed))
                 {
-                    result.collided = true;
-                    result.collidedWith = obj.get();
-
-                    std::visit([&](const auto& s)
-                        {
-                            using T = std::decay_t<decltype(s)>;
-                            if constexpr (std::is_same_v<T, sf::FloatRect>)
-                                result.penetration = getMinimumTranslationVector(entityBounds, s);
-                            else if constexpr (std::is_same_v<T, CollisionPolygon>)
-                                result.penetration = getMTVPolygon(entityBounds, s.points);
-                        }, shape);
-
-                    return result;
                 }
+                return;
             }
-        }
-        else
+    });
+
+    const int hitIndex = firstHit.load();
+    if (hitIndex < objectCount)
+        testObject(entityBounds, objects[hitIndex], result);
+
+    return result;
+}
+
+bool CollisionManager::testObject(const sf::FloatRect& entityBounds, const WorldObject& obj,
+    CollisionResult& result) const
+{
+    // Broad-phase: skip if sprite AABB doesn't intersect
+    if (!entityBounds.findIntersection(obj.getBounds()).has_value())
+        return false;
+
+    if (!obj.hasCollisionShapes())
+    {
+        // No TMX shapes for this type, fall back to sprite AABB
+        result.collided = true;
+        result.penetration = getMinimumTranslationVector(entityBounds, obj.getBounds());
+        result.collidedObject = &obj;
+        return true;
+    }
+
+    const auto worldShapes = obj.getWorldSpaceShapes();
+
+    for (const auto& shape : worldShapes)
+    {
+        bool hit = std::visit([&](const auto& s) -> bool
+            {
+                using T = std::decay_t<decltype(s)>;
+                if constexpr (std::is_same_v<T, sf::FloatRect>)
+                    return entityBounds.findIntersection(s).has_value();
+                else if constexpr (std::is_same_v<T, CollisionPolygon>)
+                    return entityBounds.findIntersection(s.bounds).has_value()
+                        && aabbVsPolygon(entityBounds, s.points);
+                return false;
+            }, shape);
+
+        if (hit)
         {
-            // No TMX shapes for this type, fall back to sprite AABB
             result.collided = true;
-            result.penetration = getMinimumTranslationVector(entityBounds, obj->getBounds());
-            result.collidedWith = obj.get();
-            return result;
+            result.collidedObject = &obj;
+
+            std::visit([&](const auto& s)
+                {
+                    using T = std::decay_t<decltype(s)>;
+                    if constexpr (std::is_same_v<T, sf::FloatRect>)
+                        result.penetration = getMinimumTranslationVector(entityBounds, s);
+                    else if constexpr (std::is_same_v<T, CollisionPolygon>)
+                        result.penetration = getMTVPolygon(entityBounds, s.points);
+                }, shape);
+
+            return true;
         }
     }
 
-    return result;
+    return false;
 }
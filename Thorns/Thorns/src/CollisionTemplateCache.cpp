@@ -0,0 +1,229 @@
+#include "CollisionTemplateCache.h"
+#include "MappedFile.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<CollisionTemplateCache::Header>, "Template cache header must be POD");
+static_assert(sizeof(CollisionTemplateCache::Header) == 24, "Header layout changed, bump FILE_VERSION");
+static_assert(sizeof(CollisionTemplateCache::GroupRecord) == 52, "GroupRecord layout changed, bump FILE_VERSION");
+static_assert(sizeof(CollisionTemplateCache::ShapeRecord) == 28, "ShapeRecord layout changed, bump FILE_VERSION");
+static_assert(sizeof(CollisionTemplateCache::PointRecord) == 8, "PointRecord layout changed, bump FILE_VERSION");
+
+namespace
+{
+    const char* CACHE_DIRECTORY = "cache/templates";
+
+    enum ShapeKind : std::uint8_t
+    {
+        SHAPE_RECT = 0,
+        SHAPE_POLYGON = 1,
+    };
+}
+
+std::string CollisionTemplateCache::cachePathFor(const std::string& tmxPath)
+{
+    // hideout.tmx -> cache/templates/hideout.tmx.bin, asset names are unique so the stem is enough
+    return std::string(CACHE_DIRECTORY) + "/" + std::filesystem::path(tmxPath).filename().string() + ".bin";
+}
+
+bool CollisionTemplateCache::isStale(const std::string& tmxPath, const std::string& cachePath)
+{
+    std::error_code error;
+    const auto cacheTime = std::filesystem::last_write_time(cachePath, error);
+    if (error)
+        return true;
+
+    // No source (stripped build) means the cache is all there is
+    const auto sourceTime = std::filesystem::last_write_time(tmxPath, error);
+    if (error)
+        return false;
+
+    return sourceTime > cacheTime;
+}
+
+// ========================================================================================================
+// LOAD
+// ========================================================================================================
+bool CollisionTemplateCache::load(const std::string& tmxPath, std::vector<Group>& outGroups)
+{
+    PROFILE_ZONE("CollisionTemplateCache::load");
+
+    const std::string cachePath = cachePathFor(tmxPath);
+    if (isStale(tmxPath, cachePath))
+        return false;
+
+    MappedFile file;
+    if (!file.open(cachePath) || file.size() < sizeof(Header))
+        return false;
+
+    const std::uint8_t* data = file.data();
+    const Header* header = reinterpret_cast<const Header*>(data);
+
+    if (header->magic != FILE_MAGIC || header->version != FILE_VERSION)
+    {
+        LOG_WARN(Core, "Template cache %s is out of date, reparsing %s", cachePath.c_str(), tmxPath.c_str());
+        return false;
+    }
+
+    // Sections follow the header back to back, everything is 4 byte aligned
+    const size_t groupsOffset = sizeof(Header);
+    const size_t shapesOffset = groupsOffset + size_t(header->groupCount) * sizeof(GroupRecord);
+    const size_t pointsOffset = shapesOffset + size_t(header->shapeCount) * sizeof(ShapeRecord);
+    const size_t totalSize = pointsOffset + size_t(header->pointCount) * sizeof(PointRecord);
+
+    if (totalSize != file.size())
+    {
+        std::cerr << "CollisionTemplateCache: " << cachePath << " is truncated\n";
+        return false;
+    }
+
+    const GroupRecord* groups = reinterpret_cast<const GroupRecord*>(data + groupsOffset);
+    const ShapeRecord* shapes = reinterpret_cast<const ShapeRecord*>(data + shapesOffset);
+    const PointRecord* points = reinterpret_cast<const PointRecord*>(data + pointsOffset);
+
+    outGroups.clear();
+    outGroups.reserve(header->groupCount);
+
+    for (std::uint32_t g = 0; g < header->groupCount; ++g)
+    {
+        const GroupRecord& groupRecord = groups[g];
+        if (std::uint64_t(groupRecord.firstShape) + groupRecord.shapeCount > header->shapeCount)
+        {
+            std::cerr << "CollisionTemplateCache: " << cachePath << " has a corrupt group table\n";
+            outGroups.clear();
+            return false;
+        }
+
+        Group group;
+        group.name.assign(groupRecord.name, strnlen(groupRecord.name, sizeof(groupRecord.name)));
+        group.id = groupRecord.id;
+        group.size = sf::Vector2f(groupRecord.sizeX, groupRecord.sizeY);
+        group.shapes.reserve(groupRecord.shapeCount);
+
+        for (std::uint32_t s = 0; s < groupRecord.shapeCount; ++s)
+        {
+            const ShapeRecord& shape = shapes[groupRecord.firstShape + s];
+            const sf::FloatRect aabb(sf::Vector2f(shape.left, shape.top), sf::Vector2f(shape.width, shape.height));
+
+            if (shape.kind == SHAPE_RECT)
+            {
+                group.shapes.emplace_back(aabb);
+                continue;
+            }
+
+            if (std::uint64_t(shape.firstPoint) + shape.pointCount > header->pointCount)
+            {
+                std::cerr << "CollisionTemplateCache: " << cachePath << " has a corrupt shape table\n";
+                outGroups.clear();
+                return false;
+            }
+
+            CollisionPolygon poly;
+            poly.points.reserve(shape.pointCount);
+            for (std::uint32_t p = 0; p < shape.pointCount; ++p)
+                poly.points.emplace_back(points[shape.firstPoint + p].x, points[shape.firstPoint + p].y);
+            poly.bounds = aabb;
+
+            group.shapes.emplace_back(std::move(poly));
+        }
+
+        outGroups.push_back(std::move(group));
+    }
+
+    LOG_DEBUG(Core, "Loaded %u collision templates from %s", header->groupCount, cachePath.c_str());
+    return true;
+}
+
+// ========================================================================================================
+// SAVE
+// ========================================================================================================
+bool CollisionTemplateCache::save(const std::string& tmxPath, const std::vector<Group>& groups)
+{
+    PROFILE_ZONE("CollisionTemplateCache::save");
+
+    std::vector<GroupRecord> groupRecords;
+    std::vector<ShapeRecord> shapeRecords;
+    std::vector<PointRecord> pointRecords;
+    groupRecords.reserve(groups.size());
+
+    for (const Group& group : groups)
+    {
+        GroupRecord groupRecord{};
+        std::strncpy(groupRecord.name, group.name.c_str(), sizeof(groupRecord.name) - 1);
+        groupRecord.id = group.id;
+        groupRecord.sizeX = group.size.x;
+        groupRecord.sizeY = group.size.y;
+        groupRecord.firstShape = static_cast<std::uint32_t>(shapeRecords.size());
+        groupRecord.shapeCount = static_cast<std::uint32_t>(group.shapes.size());
+        groupRecords.push_back(groupRecord);
+
+        for (const CollisionShape& shape : group.shapes)
+        {
+            ShapeRecord shapeRecord{};
+
+            std::visit([&](const auto& s)
+            {
+                    using T = std::decay_t<decltype(s)>;
+                    sf::FloatRect aabb;
+
+                    if constexpr (std::is_same_v<T, sf::FloatRect>)
+                    {
+                        shapeRecord.kind = SHAPE_RECT;
+                        aabb = s;
+                    }
+                    else if constexpr (std::is_same_v<T, CollisionPolygon>)
+                    {
+                        shapeRecord.kind = SHAPE_POLYGON;
+                        shapeRecord.firstPoint = static_cast<std::uint32_t>(pointRecords.size());
+                        shapeRecord.pointCount = static_cast<std::uint32_t>(s.points.size());
+                        for (const auto& pt : s.points)
+                            pointRecords.push_back({ pt.x, pt.y });
+                        aabb = s.bounds;
+                    }
+
+                    shapeRecord.left = aabb.position.x;
+                    shapeRecord.top = aabb.position.y;
+                    shapeRecord.width = aabb.size.x;
+                    shapeRecord.height = aabb.size.y;
+            }, shape);
+
+            shapeRecords.push_back(shapeRecord);
+        }
+    }
+
+    Header header{};
+    header.magic = FILE_MAGIC;
+    header.version = FILE_VERSION;
+    header.groupCount = static_cast<std::uint32_t>(groupRecords.size());
+    header.shapeCount = static_cast<std::uint32_t>(shapeRecords.size());
+    header.pointCount = static_cast<std::uint32_t>(pointRecords.size());
+
+    std::error_code error;
+    std::filesystem::create_directories(CACHE_DIRECTORY, error);
+
+    const std::string cachePath = cachePathFor(tmxPath);
+    std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "CollisionTemplateCache: Failed to open " << cachePath << " for writing\n";
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(groupRecords.data()), groupRecords.size() * sizeof(GroupRecord));
+    file.write(reinterpret_cast<const char*>(shapeRecords.data()), shapeRecords.size() * sizeof(ShapeRecord));
+    file.write(reinterpret_cast<const char*>(pointRecords.data()), pointRecords.size() * sizeof(PointRecord));
+
+    if (!file.good())
+    {
+        std::cerr << "CollisionTemplateCache: Write failed for " << cachePath << "\n";
+        return false;
+    }
+
+    return true;
+}
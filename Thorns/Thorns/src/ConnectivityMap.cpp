@@ -0,0 +1,324 @@
+#include "ConnectivityMap.h"
+#include "Map.h"
+#include "Profiler.h"
+#include <limits>
+
+namespace
+{
+    const int NEIGHBOUR_DX[4] = { 1, -1, 0, 0 };
+    const int NEIGHBOUR_DY[4] = { 0, 0, 1, -1 };
+
+    // Blocked tiles outside POIs (thickets etc) can be cut through, POI walls never are
+    bool isCarvable(const MapTile& tile)
+    {
+        return !tile.isWalkable() && tile.getTerrainType() != MapTile::TerrainType::POI_Collision;
+    }
+}
+
+ConnectivityMap::ConnectivityMap()
+    : m_width(0)
+    , m_height(0)
+    , m_componentCount(0)
+{
+}
+
+// ========================================================================================================
+// LABELLING (scanline union-find)
+// ========================================================================================================
+int ConnectivityMap::labelComponents(const Map& map)
+{
+    PROFILE_ZONE("Connectivity::label");
+
+    m_width = map.getWidth();
+    m_height = map.getHeight();
+
+    const size_t tileCount = static_cast<size_t>(m_width) * m_height;
+    m_labels.assign(tileCount, UNREACHABLE);
+    m_parent.clear();
+
+    // Pass 1: label runs, unite with the row above
+    for (int y = 0; y < m_height; ++y)
+    {
+        int x = 0;
+        while (x < m_width)
+        {
+            if (!map.getTile(x, y)->isWalkable())
+            {
+                ++x;
+                continue;
+            }
+
+            const int runStart = x;
+            while (x < m_width && map.getTile(x, y)->isWalkable())
+                ++x;
+
+            const int label = static_cast<int>(m_parent.size());
+            m_parent.push_back(label);
+
+            for (int runX = runStart; runX < x; ++runX)
+            {
+                m_labels[index(runX, y)] = label;
+
+                if (y > 0)
+                {
+                    const int above = m_labels[index(runX, y - 1)];
+                    if (above != UNREACHABLE)
+                        unite(label, above);
+                }
+            }
+        }
+    }
+
+    // Pass 2: flatten roots to 0..N-1, m_cost doubles as the root -> component table here
+    m_cost.assign(m_parent.size(), UNREACHABLE);
+    m_componentCount = 0;
+
+    for (int& label : m_labels)
+    {
+        if (label == UNREACHABLE)
+            continue;
+
+        const int root = findRoot(label);
+        if (m_cost[root] == UNREACHABLE)
+            m_cost[root] = m_componentCount++;
+
+        label = m_cost[root];
+    }
+
+    return m_componentCount;
+}
+
+int ConnectivityMap::findRoot(int label)
+{
+    // Path halving, keeps the trees flat without recursion
+    while (m_parent[label] != label)
+    {
+        m_parent[label] = m_parent[m_parent[label]];
+        label = m_parent[label];
+    }
+    return label;
+}
+
+void ConnectivityMap::unite(int a, int b)
+{
+    a = findRoot(a);
+    b = findRoot(b);
+    if (a == b)
+        return;
+
+    // Older label wins, keeps roots low so the flatten pass stays in order
+    if (a < b)
+        m_parent[b] = a;
+    else
+        m_parent[a] = b;
+}
+
+// ========================================================================================================
+// REPAIR (0-1 BFS from the source component)
+// ========================================================================================================
+ConnectivityMap::Report ConnectivityMap::connectTargets(Map& map, const sf::Vector2i& source,
+    const std::vector<sf::Vector2i>& targets)
+{
+    PROFILE_ZONE("Connectivity::connect");
+
+    Report report;
+    report.componentCount = m_componentCount;
+    report.targetsChecked = static_cast<int>(targets.size());
+
+    if (!inBounds(source.x, source.y) || m_labels[index(source.x, source.y)] == UNREACHABLE)
+        return report;
+
+    const int sourceComponent = m_labels[index(source.x, source.y)];
+
+    // Quick check first, most maps need no repair at all and skip the BFS
+    bool anyUnreachable = false;
+    for (const sf::Vector2i& target : targets)
+    {
+        if (!inBounds(target.x, target.y) || m_labels[index(target.x, target.y)] != sourceComponent)
+        {
+            anyUnreachable = true;
+            break;
+        }
+    }
+
+    if (!anyUnreachable)
+        return report;
+
+    const int tileCount = m_width * m_height;
+    m_cost.assign(tileCount, std::numeric_limits<int>::max());
+    m_cameFrom.assign(tileCount, UNREACHABLE);
+
+    // Each tile is pushed at most twice in a 0-1 BFS, the ring never wraps onto itself
+    const int capacity = tileCount * 2 + 1;
+    if (static_cast<int>(m_queue.size()) < capacity)
+        m_queue.resize(capacity);
+
+    int head = 0;
+    int tail = 0;
+    auto pushFront = [&](int tile) { head = (head - 1 + capacity) % capacity; m_queue[head] = tile; };
+    auto pushBack = [&](int tile) { m_queue[tail] = tile; tail = (tail + 1) % capacity; };
+
+    // Whole source component starts at cost 0
+    for (int i = 0; i < tileCount; ++i)
+    {
+        if (m_labels[i] == sourceComponent)
+        {
+            m_cost[i] = 0;
+            pushBack(i);
+        }
+    }
+
+    while (head != tail)
+    {
+        const int current = m_queue[head];
+        head = (head + 1) % capacity;
+
+        const int cx = current % m_width;
+        const int cy = current / m_width;
+
+        for (int dir = 0; dir < 4; ++dir)
+        {
+            const int nx = cx + NEIGHBOUR_DX[dir];
+            const int ny = cy + NEIGHBOUR_DY[dir];
+            if (!inBounds(nx, ny))
+                continue;
+
+            const MapTile& tile = *map.getTile(nx, ny);
+            int step = 0;
+            if (!tile.isWalkable())
+            {
+                if (!isCarvable(tile))
+                    continue;
+                step = 1;
+            }
+
+            const int next = index(nx, ny);
+            const int newCost = m_cost[current] + step;
+            if (newCost >= m_cost[next])
+                continue;
+
+            m_cost[next] = newCost;
+            m_cameFrom[next] = current;
+
+            if (step == 0)
+                pushFront(next);
+            else
+                pushBack(next);
+        }
+    }
+
+    // Walk each unreachable target back to the source component, carving as it goes.
+    // Components a corridor passes through are joined too, so later targets in them are skipped
+    m_joined.assign(m_componentCount, 0);
+    m_joined[sourceComponent] = 1;
+
+    auto isJoined = [&](int tile) { return m_labels[tile] != UNREACHABLE && m_joined[m_labels[tile]]; };
+
+    for (const sf::Vector2i& target : targets)
+    {
+        if (!inBounds(target.x, target.y))
+        {
+            ++report.targetsSkipped;
+            continue;
+        }
+
+        const int targetTile = index(target.x, target.y);
+        if (isJoined(targetTile))
+            continue;
+
+        ++report.targetsUnreachable;
+
+        if (m_cameFrom[targetTile] == UNREACHABLE)
+        {
+            ++report.targetsSkipped;
+            continue;
+        }
+
+        // Joined flags are only set once the walk is done, otherwise the walk would stop
+        // at the second tile of the first component it crosses
+        m_crossed.clear();
+
+        for (int tile = targetTile; tile != UNREACHABLE && !isJoined(tile); tile = m_cameFrom[tile])
+        {
+            if (m_labels[tile] != UNREACHABLE)
+            {
+                m_crossed.push_back(m_labels[tile]);
+                continue;
+            }
+
+            MapTile* mapTile = map.getTile(tile % m_width, tile / m_width);
+            mapTile->setTerrainType(MapTile::TerrainType::Forest);
+            mapTile->setWalkable(true);
+            m_labels[tile] = sourceComponent;
+            ++report.tilesCarved;
+        }
+
+        for (int component : m_crossed)
+            m_joined[component] = 1;
+    }
+
+    return report;
+}
+
+// ========================================================================================================
+// DISTANCE FIELD
+// ========================================================================================================
+void ConnectivityMap::buildDistanceField(const Map& map, const sf::Vector2i& source)
+{
+    PROFILE_ZONE("Connectivity::distanceField");
+
+    const int tileCount = m_width * m_height;
+    m_distance.assign(tileCount, UNREACHABLE);
+
+    if (!inBounds(source.x, source.y) || !map.getTile(source.x, source.y)->isWalkable())
+        return;
+
+    if (static_cast<int>(m_queue.size()) < tileCount)
+        m_queue.resize(tileCount);
+
+    // Every tile is queued once, a flat array is enough
+    int head = 0;
+    int tail = 0;
+    const int start = index(source.x, source.y);
+    m_distance[start] = 0;
+    m_queue[tail++] = start;
+
+    while (head < tail)
+    {
+        const int current = m_queue[head++];
+        const int cx = current % m_width;
+        const int cy = current / m_width;
+
+        for (int dir = 0; dir < 4; ++dir)
+        {
+            const int nx = cx + NEIGHBOUR_DX[dir];
+            const int ny = cy + NEIGHBOUR_DY[dir];
+            if (!inBounds(nx, ny))
+                continue;
+
+            const int next = index(nx, ny);
+            if (m_distance[next] != UNREACHABLE || !map.getTile(nx, ny)->isWalkable())
+                continue;
+
+            m_distance[next] = m_distance[current] + 1;
+            m_queue[tail++] = next;
+        }
+    }
+}
+
+// ========================================================================================================
+// QUERIES
+// ========================================================================================================
+int ConnectivityMap::getComponent(int x, int y) const
+{
+    if (!inBounds(x, y) || m_labels.empty())
+        return UNREACHABLE;
+    return m_labels[index(x, y)];
+}
+
+int ConnectivityMap::getDistance(int x, int y) const
+{
+    if (!inBounds(x, y) || m_distance.empty())
+        return UNREACHABLE;
+    return m_distance[index(x, y)];
+}
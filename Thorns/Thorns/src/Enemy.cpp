@@ -5,9 +5,10 @@ Enemy::Enemy()
 {
 }
 
-bool Enemy::initialize(const std::string& texturePath)
+bool Enemy::initialize(const sf::Texture& texture)
 {
-    if (!m_sprite.loadTexture(texturePath, 64.f, 64.f))
+    const sf::Vector2i textureSize(texture.getSize());
+    if (!m_sprite.setTexture(texture, 64.f, 64.f, sf::IntRect(sf::Vector2i(0, 0), textureSize)))
         return false;
 
     // Set initial position
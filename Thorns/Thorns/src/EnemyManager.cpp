@@ -1,6 +1,8 @@
 #include "EnemyManager.h"
 #include "CollisionManager.h"
+#include "JobSystem.h"
 #include "Map.h"
+#include "Profiler.h"
 #include <iostream>
 
 EnemyManager::EnemyManager()
@@ -12,10 +14,23 @@ EnemyManager::EnemyManager()
 bool EnemyManager::initialize(const std::string& savageAtlasPath,
     const std::string& chomperAtlasPath)
 {
-    // Pre-warm every pool slot so textures are loaded once
+    // Textures are loaded once here, every pool slot views the same atlas
+    if (!m_savageAtlas.loadFromFile(savageAtlasPath))
+    {
+        std::cerr << "EnemyManager: Failed to load savage atlas: " << savageAtlasPath << "\n";
+        return false;
+    }
+
+    if (!m_chomperAtlas.loadFromFile(chomperAtlasPath))
+    {
+        std::cerr << "EnemyManager: Failed to load chomper atlas: " << chomperAtlasPath << "\n";
+        return false;
+    }
+
+    // Pre-warm every pool slot
     for (auto& enemy : m_savagePool)
     {
-        if (!enemy.initialize(savageAtlasPath))
+        if (!enemy.initialize(m_savageAtlas))
         {
             std::cerr << "EnemyManager: Failed to initialize SavageEnemy pool slot\n";
             return false;
@@ -25,7 +40,7 @@ bool EnemyManager::initialize(const std::string& savageAtlasPath,
 
     for (auto& enemy : m_chomperPool)
     {
-        if (!enemy.initialize(chomperAtlasPath))
+        if (!enemy.initialize(m_chomperAtlas))
         {
             std::cerr << "EnemyManager: Failed to initialize ChomperEnemy pool slot\n";
             return false;
@@ -98,16 +113,23 @@ void EnemyManager::updateAll(sf::Time deltaTime,
     const Map* map,
     const CollisionManager& collisionManager)
 {
-    for (auto& enemy : m_savagePool)
-    {
-        if (!enemy.isActive()) continue;
-        enemy.updateWithContext(deltaTime, playerPos, map);
-        resolveEnemyCollision(enemy, map, collisionManager);
-    }
+    PROFILE_ZONE("EnemyManager::updateAll");
 
-    for (auto& enemy : m_chomperPool)
+    // One job per pool slot across both pools. Each enemy only reads the map and the player
+    // position and only writes itself, so the slots can run in any order on any thread
+    auto updateSlot = [&](int slot)
     {
-        if (!enemy.isActive()) continue;
+        if (slot < MAX_SAVAGE)
+        {
+            SavageEnemy& enemy = m_savagePool[slot];
+            if (!enemy.isActive()) return;
+            enemy.updateWithContext(deltaTime, playerPos, map);
+            resolveEnemyCollision(enemy, map, collisionManager);
+            return;
+        }
+
+        ChomperEnemy& enemy = m_chomperPool[slot - MAX_SAVAGE];
+        if (!enemy.isActive()) return;
         enemy.updateWithContext(deltaTime, playerPos, map);
 
         // ChomperEnemy has its own applyCollisionCorrection to abort leaps on wall hit
@@ -121,7 +143,13 @@ void EnemyManager::updateAll(sf::Time deltaTime,
         {
 
         }
-    }
+    };
+
+    JobSystem::parallelFor(0, MAX_SAVAGE + MAX_CHOMPER, ENEMIES_PER_JOB, [&](int begin, int end)
+    {
+            for (int slot = begin; slot < end; ++slot)
+                updateSlot(slot);
+    });
 }
 
 void EnemyManager::renderAll(sf::RenderTarget& target) const
@@ -133,6 +161,58 @@ void EnemyManager::renderAll(sf::RenderTarget& target) const
         if (enemy.isActive()) enemy.render(target);
 }
 
+void EnemyManager::captureSprites(std::vector<sf::Sprite>& out) const
+{
+    for (const auto& enemy : m_savagePool)
+        if (enemy.isActive() && enemy.getSpriteView().isValid())
+            out.push_back(enemy.getSpriteView().getSprite());
+
+    for (const auto& enemy : m_chomperPool)
+        if (enemy.isActive() && enemy.getSpriteView().isValid())
+            out.push_back(enemy.getSpriteView().getSprite());
+}
+
+// ========================================
+// Render Interpolation
+// ========================================
+void EnemyManager::storePreviousPositions()
+{
+    for (size_t i = 0; i < m_savagePool.size(); ++i)
+        m_savagePrevPos[i] = m_savagePool[i].getPosition();
+
+    for (size_t i = 0; i < m_chomperPool.size(); ++i)
+        m_chomperPrevPos[i] = m_chomperPool[i].getPosition();
+}
+
+void EnemyManager::applyInterpolation(float alpha)
+{
+    interpolatePool(m_savagePool, m_savagePrevPos, m_savageTickPos, alpha);
+    interpolatePool(m_chomperPool, m_chomperPrevPos, m_chomperTickPos, alpha);
+}
+
+void EnemyManager::restoreTickPositions()
+{
+    for (size_t i = 0; i < m_savagePool.size(); ++i)
+        if (m_savagePool[i].isActive()) m_savagePool[i].setPosition(m_savageTickPos[i]);
+
+    for (size_t i = 0; i < m_chomperPool.size(); ++i)
+        if (m_chomperPool[i].isActive()) m_chomperPool[i].setPosition(m_chomperTickPos[i]);
+}
+
+template<typename TPool, typename TPositions>
+void EnemyManager::interpolatePool(TPool& pool, const TPositions& previous,
+    TPositions& tickPositions, float alpha)
+{
+    for (size_t i = 0; i < pool.size(); ++i)
+    {
+        if (!pool[i].isActive()) continue;
+
+        const sf::Vector2f current = pool[i].getPosition();
+        tickPositions[i] = current;
+        pool[i].setPosition(previous[i] + (current - previous[i]) * alpha);
+    }
+}
+
 // Queries
 int EnemyManager::getActiveSavageCount() const
 {
@@ -231,4 +311,4 @@ void EnemyManager::resolveEnemyCollision(TEnemyType& enemy,
         sf::Vector2f correction = collisionManager.resolveCollision(worldResult);
         enemy.setPosition(enemy.getPosition() + correction);
     }
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -1,26 +1,85 @@
 #include "Game.h"
 #include "AssetPaths.h"
+#include "Profiler.h"
+#include "Logger.h"
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <thread>
 
 Game::Game()
-    : m_window(sf::VideoMode{ sf::Vector2u{1920U, 1080U}, 32U }, "THORNS")
+    : Game(LaunchOptions{})
+{
+}
+
+Game::Game(const LaunchOptions& options)
+    : m_options(options)
     , m_gameView(sf::FloatRect(sf::Vector2f(0.f, 0.f), sf::Vector2f(1920.f, 1080.f)))
     , m_uiView(sf::FloatRect(sf::Vector2f(0.f, 0.f), sf::Vector2f(1920.f, 1080.f)))
     , m_exitGame(false)
     , m_gameValid(false)
     , m_mousePressed(false)
     , m_screenSettings()  // Initialize screen settings
+    , m_frontSnapshot(0)
+    , m_pendingTicks(0)
+    , m_pendingAlpha(0.f)
+    , m_simInFlight(false)
 {
+    // Headless never opens a window, only the update loop runs
+    if (!m_options.headless)
+    {
+        m_window.create(sf::VideoMode{ sf::Vector2u{1920U, 1080U}, 32U }, "THORNS");
+        m_window.setVerticalSyncEnabled(m_options.vsync);
+    }
+
+    // A replay carries the seed and map size it was recorded with, those win over the command line
+    if (!m_options.replayPath.empty() && m_recorder.loadRecording(m_options.replayPath))
+    {
+        const InputRecorder::SessionInfo& info = m_recorder.getSessionInfo();
+        m_options.seed = info.seed;
+        m_options.mapWidth = info.mapWidth;
+        m_options.mapHeight = info.mapHeight;
+        LOG_INFO(Core, "Replaying %zu ticks from %s (seed %u)",
+            m_recorder.getFrameCount(), m_options.replayPath.c_str(), info.seed);
+    }
+
     // Register state change callbacks with the state manager
     m_stateManager.setOnStateEnter([this](GameState state) { onStateEnter(state); });
     m_stateManager.setOnStateExit([this](GameState state) { onStateExit(state); });
 
     // Load all resources and setup game
     m_gameValid = initializeGame();
+
+    // Start recording only once the map exists, the first recorded tick is the first update
+    if (m_gameValid && !m_options.recordPath.empty() && !m_recorder.isPlayingBack())
+    {
+        InputRecorder::SessionInfo info;
+        info.seed = m_options.seed;
+        info.mapWidth = m_options.mapWidth;
+        info.mapHeight = m_options.mapHeight;
+
+        if (!m_options.headless)
+        {
+            info.viewportWidth = static_cast<std::uint16_t>(m_window.getSize().x);
+            info.viewportHeight = static_cast<std::uint16_t>(m_window.getSize().y);
+        }
+
+        m_recorder.startRecording(info);
+    }
+
+    // Worker only exists for the windowed game, headless has nothing to overlap with
+    if (m_gameValid && m_options.threadedSim && !m_options.headless)
+    {
+        m_deferredActions.reserve(4);
+        m_simWorker.start([this]() { simulationJob(); });
+        LOG_INFO(Core, "Threaded simulation enabled");
+    }
 }
 
 Game::~Game()
 {
+    // Join before any member the job touches is destroyed
+    m_simWorker.stop();
 }
 
 bool Game::initializeGame()
@@ -80,12 +139,19 @@ bool Game::initializeGame()
     {
         std::cerr << "Game: DayTimer failed to initialize\n";
     }
-    m_dayTimer.setOnExpired([this]() { regenerateMap(); });
+    m_dayTimer.setOnExpired([this]() { runOnMainThread([this]() { regenerateMap(); }); });
+
+    if (!m_profilerOverlay.initialize(Assets::Fonts::JERSEY_20))
+    {
+        std::cerr << "Game: Profiler overlay failed to initialize\n";
+    }
 
     // Now that resources are loaded, configure the menus
     setupMenus();
 
-    // Generate the starting map
+    // Generate the starting map, known seed/settings pairs come straight out of the cache
+    if (m_options.mapCache)
+        m_mapGenerator.setCache(&m_generationCache);
     generateMap();
 
 
@@ -122,10 +188,10 @@ void Game::setupMenus()
 void Game::generateMap()
 {
     // Configure generation settings (Defaults in base class, change here for testing)
-    m_mapSettings.mapWidth = 160;
-    m_mapSettings.mapHeight = 160;
+    m_mapSettings.mapWidth = m_options.mapWidth;
+    m_mapSettings.mapHeight = m_options.mapHeight;
     m_mapSettings.tileSize = 64.f;
-    m_currentSeed = 12345;
+    m_currentSeed = m_options.seed;
     m_mapSettings.seed = m_currentSeed;
 
     // ========== PHASE 1: VORONOI SITES SETTINGS ==========
@@ -147,8 +213,31 @@ void Game::generateMap()
     m_mapSettings.objectOctaves = 2;             // Some detail variation
     m_mapSettings.objectThreshold = 0.65;        // Moderately sparse placement
 
-    // Generating map
-    m_map = m_mapGenerator.generate(m_mapSettings);
+    // ========== PHASE 3: CELLULAR AUTOMATA SETTINGS ==========
+    m_mapSettings.enableCellularAutomata = true;
+    m_mapSettings.caFillChance = 0.42f;          // ~25% of the grass ends up as thicket
+    m_mapSettings.caIterations = 4;
+    m_mapSettings.caBirthMask = CellularAutomata::makeMask("5678");
+    m_mapSettings.caSurvivalMask = CellularAutomata::makeMask("45678");
+
+    // Generating map, or restoring it from a snapshot when one was given
+    std::vector<sf::Vector2f> enemySpawns;
+    std::vector<sf::Vector2f> itemSpawns;
+
+    if (m_options.loadMapPath.empty() || !loadMapSnapshot(m_options.loadMapPath, enemySpawns, itemSpawns))
+    {
+        m_map = m_mapGenerator.generate(m_mapSettings);
+        m_mapGenerator.getEnemySpawnPoints(m_map.get(), enemySpawns, 2, 100.f); // Spawn near POIs
+        m_mapGenerator.getItemSpawnPoints(m_map.get(), itemSpawns, 20.0f);
+    }
+
+    if (!m_options.saveMapPath.empty())
+    {
+        std::vector<std::uint8_t> bytes;
+        m_mapGenerator.buildSnapshot(m_map.get(), m_currentSeed, enemySpawns, itemSpawns, bytes);
+        if (MapSnapshot::writeFile(m_options.saveMapPath, bytes))
+            LOG_INFO(MapGen, "Saved map snapshot to %s (%zu bytes)", m_options.saveMapPath.c_str(), bytes.size());
+    }
 
     // Position player at map center (where hideout is)
     sf::Vector2f mapCenter = m_map->getWorldSize();
@@ -160,35 +249,7 @@ void Game::generateMap()
         << m_map->getWorldSize().x << "x" << m_map->getWorldSize().y << " pixels\n";
     std::cout << "TO BE REMOVED: Press 'R' during gameplay to regenerate map with new seed\n";
 
-
-    // Deactivate all enemies then spawn initial set
-    m_enemyManager.despawnAll();
-    auto spawnPoints = m_mapGenerator.getEnemySpawnPoints(2, 100.f); // Spawn near POIs
-    for (size_t i = 0; i < spawnPoints.size(); ++i)
-    {
-        // Alternate between savage and chomper
-        if (i % 2 == 0)
-            m_enemyManager.spawnSavage(spawnPoints[i]);
-        else
-            m_enemyManager.spawnChomper(spawnPoints[i]);
-    }
-
-    m_itemPool.despawnAll();
-    // Spawn weapon/item loot near POI sites
-    auto itemSpawnPoints = m_mapGenerator.getItemSpawnPoints(20.0f);
-
-    // Weapon/health types to cycle through at loot spots
-    const ItemType lootTable[] = {
-        ItemType::Knife, ItemType::Axe, ItemType::Gun,
-        ItemType::FirstAid, ItemType::Bandage
-    };
-    constexpr int lootTableSize = 5;
-
-    for (size_t i = 0; i < itemSpawnPoints.size(); ++i)
-    {
-        ItemType lootType = lootTable[i % lootTableSize];
-        m_itemPool.spawn(lootType, itemSpawnPoints[i], m_itemTypeRegistry);
-    }
+    populateWorld(enemySpawns, itemSpawns);
 
     m_itemPool.spawn(ItemType::Food, mapCenter + sf::Vector2f(100, -400), m_itemTypeRegistry);
     m_itemPool.spawn(ItemType::Water, mapCenter + sf::Vector2f(150, -400), m_itemTypeRegistry);
@@ -197,6 +258,9 @@ void Game::generateMap()
     m_itemPool.spawn(ItemType::Knife, mapCenter + sf::Vector2f(300, -400), m_itemTypeRegistry);
     m_itemPool.spawn(ItemType::Axe, mapCenter + sf::Vector2f(350, -400), m_itemTypeRegistry);
     m_itemPool.spawn(ItemType::Gun , mapCenter + sf::Vector2f(400, -400), m_itemTypeRegistry);
+
+    // Everything just teleported, don't blend from the old positions
+    storePreviousPositions();
 }
 
 void Game::regenerateMap()
@@ -216,21 +280,72 @@ void Game::regenerateMap()
     mapCenter.y /= 2.f;
     m_player.setPosition(mapCenter);
 
+    std::vector<sf::Vector2f> enemySpawns;
+    std::vector<sf::Vector2f> itemSpawns;
+    m_mapGenerator.getEnemySpawnPoints(m_map.get(), enemySpawns, 2, 100.f);
+    m_mapGenerator.getItemSpawnPoints(m_map.get(), itemSpawns, 20.0f);
+    populateWorld(enemySpawns, itemSpawns);
+
+    std::cout << "Map regenerated with seed " << m_currentSeed << "!\n";
+    std::cout << "======================================\n\n";
+
+    m_dayTimer.reset();
+
+    // Everything just teleported, don't blend from the old positions
+    storePreviousPositions();
+}
+
+bool Game::loadMapSnapshot(const std::string& filePath, std::vector<sf::Vector2f>& enemySpawns,
+    std::vector<sf::Vector2f>& itemSpawns)
+{
+    MapSnapshot snapshot;
+    if (!snapshot.loadFile(filePath))
+    {
+        std::cerr << "Could not load map snapshot " << filePath << ", generating instead\n";
+        return false;
+    }
+
+    m_map = m_mapGenerator.load(snapshot);
+    if (!m_map)
+    {
+        std::cerr << "Map snapshot " << filePath << " could not be restored, generating instead\n";
+        return false;
+    }
+
+    // Regenerating later should keep the loaded size and carry on from the loaded seed
+    const MapSnapshot::Header& header = snapshot.getHeader();
+    m_currentSeed = header.seed;
+    m_mapSettings.seed = header.seed;
+    m_mapSettings.mapWidth = header.width;
+    m_mapSettings.mapHeight = header.height;
+    m_mapSettings.tileSize = header.tileSize;
+
+    enemySpawns.clear();
+    for (const MapSnapshot::SpawnRecord& spawn : snapshot.getEnemySpawns())
+        enemySpawns.emplace_back(spawn.x, spawn.y);
+
+    itemSpawns.clear();
+    for (const MapSnapshot::SpawnRecord& spawn : snapshot.getItemSpawns())
+        itemSpawns.emplace_back(spawn.x, spawn.y);
+
+    LOG_INFO(MapGen, "Loaded map snapshot %s (seed %u)", filePath.c_str(), header.seed);
+    return true;
+}
+
+void Game::populateWorld(const std::vector<sf::Vector2f>& enemySpawns, const std::vector<sf::Vector2f>& itemSpawns)
+{
     // Deactivate all enemies then spawn initial set
     m_enemyManager.despawnAll();
-    auto spawnPoints = m_mapGenerator.getEnemySpawnPoints(2, 100.f); // Spawn near POIs
-    for (size_t i = 0; i < spawnPoints.size(); ++i)
+    for (size_t i = 0; i < enemySpawns.size(); ++i)
     {
         // Alternate between savage and chomper
         if (i % 2 == 0)
-            m_enemyManager.spawnSavage(spawnPoints[i]);
+            m_enemyManager.spawnSavage(enemySpawns[i]);
         else
-            m_enemyManager.spawnChomper(spawnPoints[i]);
+            m_enemyManager.spawnChomper(enemySpawns[i]);
     }
 
     m_itemPool.despawnAll();
-    // Spawn weapon/item loot near POI sites
-    auto itemSpawnPoints = m_mapGenerator.getItemSpawnPoints(20.0f);
 
     // Weapon/health types to cycle through at loot spots
     const ItemType lootTable[] = {
@@ -239,16 +354,11 @@ void Game::regenerateMap()
     };
     constexpr int lootTableSize = 5;
 
-    for (size_t i = 0; i < itemSpawnPoints.size(); ++i)
+    for (size_t i = 0; i < itemSpawns.size(); ++i)
     {
         ItemType lootType = lootTable[i % lootTableSize];
-        m_itemPool.spawn(lootType, itemSpawnPoints[i], m_itemTypeRegistry);
+        m_itemPool.spawn(lootType, itemSpawns[i], m_itemTypeRegistry);
     }
-
-    std::cout << "Map regenerated with seed " << m_currentSeed << "!\n";
-    std::cout << "======================================\n\n";
-
-    m_dayTimer.reset();
 }
 
 void Game::run()
@@ -257,37 +367,393 @@ void Game::run()
     if (!m_gameValid)
     {
         std::cout << "Game failed to initialize. Exiting..." << std::endl;
-        std::cout << "Press Enter to close..." << std::endl;
-        std::cin.get();
+
+        // Nobody to press enter on a build machine
+        if (!m_options.headless)
+        {
+            std::cout << "Press Enter to close..." << std::endl;
+            std::cin.get();
+        }
+        return;
+    }
+
+    if (m_options.headless)
+    {
+        runHeadless();
         return;
     }
 
     // ===== Fixed Timestep Game Loop =====
-    // Updates happen at fixed 60 FPS, rendering happens as fast as possible
+    // Updates happen at fixed 60 FPS, rendering is capped at targetFps and blends between ticks
     sf::Clock clock;
+    sf::Clock frameClock;
     sf::Time timeSinceLastUpdate = sf::Time::Zero;
     const float fps = 60.0f;
     sf::Time timePerFrame = sf::seconds(1.0f / fps);
 
     while (m_window.isOpen())
     {
+        Profiler::beginFrame();
+
         // Handle events (window close, input, etc.)
         processEvents();
 
+        // Devices are read here, on the thread that owns the window, even when the ticks run
+        // on the sim worker. The ticks only ever see this frame
+        m_liveInput = m_input.pollFrame(m_window);
+
         // Accumulate time since last update
         timeSinceLastUpdate += clock.restart();
 
-        // Update at fixed timestep (may update multiple times per frame if lagging)
-        while (timeSinceLastUpdate > timePerFrame)
+        // Update at fixed timestep (may update multiple times per frame if lagging).
+        // Capped so one long hitch (map regen, window drag) can't snowball into dozens of updates
+        int ticksDue = 0;
+        while (timeSinceLastUpdate >= timePerFrame && ticksDue < MAX_UPDATES_PER_FRAME)
         {
             timeSinceLastUpdate -= timePerFrame;
-            m_input.update(m_window);              // Update input state
-            update(timePerFrame);          // Update game logic
+            ++ticksDue;
+        }
+
+        // Still behind after the cap, drop the backlog but keep the partial tick for blending
+        if (timeSinceLastUpdate >= timePerFrame)
+        {
+            LOG_DEBUG(Core, "Frame pacing: dropped %.1f ms of simulation backlog",
+                timeSinceLastUpdate.asSeconds() * 1000.f);
+            timeSinceLastUpdate = sf::seconds(
+                std::fmod(timeSinceLastUpdate.asSeconds(), timePerFrame.asSeconds()));
+        }
+
+        // Alpha is how far into the next tick we are, entities are drawn blended by it
+        const float alpha = timeSinceLastUpdate / timePerFrame;
+
+        if (m_simWorker.isRunning() && !m_exitGame
+            && m_stateManager.getCurrentState() == GameState::Playing)
+        {
+            runPipelinedFrame(ticksDue, alpha);
+        }
+        else
+        {
+            // Serial path, the next pipelined frame has to start from a fresh snapshot
+            m_snapshots[m_frontSnapshot].valid = false;
+
+            for (int i = 0; i < ticksDue; ++i)
+                stepSimulation(timePerFrame);  // Input + game logic
+
+            const bool interpolate = m_options.interpolate
+                && m_stateManager.getCurrentState() == GameState::Playing;
+
+            if (interpolate)
+                beginInterpolatedRender(alpha);
+
+            render();
+
+            if (interpolate)
+                endInterpolatedRender();
+        }
+
+        Profiler::endFrame();
+
+        limitFrameRate(frameClock);
+    }
+
+    finishRecording();
+}
+
+// One fixed tick. Input comes from the replay when one is playing, otherwise from the frame the
+// main loop polled (or nothing at all when headless). Everything the sim reads about input goes
+// through m_input.
+void Game::stepSimulation(sf::Time timePerFrame)
+{
+    if (m_recorder.isPlayingBack())
+    {
+        InputFrame frame;
+        if (m_recorder.nextFrame(frame))
+        {
+            m_input.applyFrame(frame);
+            m_mousePressed = m_input.isMousePressed();
+        }
+        else
+        {
+            // Recording ran out, headless stops here, windowed hands control back to the player
+            LOG_INFO(Core, "Replay finished after %zu ticks", m_recorder.getFrameCount());
+            m_recorder.stop();
+
+            if (m_options.headless)
+            {
+                m_exitGame = true;
+                return;
+            }
+        }
+    }
+    else if (m_options.headless)
+    {
+        // Nobody at the keyboard, feed an empty frame so previous/current still step
+        m_input.applyFrame(InputFrame{});
+    }
+
+    // Stopping playback above falls through to live input for this tick, polled by the main
+    // thread, the sim worker never touches the devices or the window
+    if (!m_options.headless && !m_recorder.isPlayingBack())
+    {
+        m_input.applyFrame(m_liveInput);
+    }
+
+    if (m_recorder.isRecording())
+    {
+        m_recorder.record(m_input.captureFrame());
+    }
+
+    storePreviousPositions();
+    update(timePerFrame);
+}
+
+// ===== Frame Pacing =====
+void Game::storePreviousPositions()
+{
+    m_prevPlayerPos = m_player.getPosition();
+    m_enemyManager.storePreviousPositions();
+}
+
+void Game::beginInterpolatedRender(float alpha)
+{
+    m_tickPlayerPos = m_player.getPosition();
+    m_tickCameraCenter = m_gameView.getCenter();
+
+    m_player.setPosition(m_prevPlayerPos + (m_tickPlayerPos - m_prevPlayerPos) * alpha);
+    m_enemyManager.applyInterpolation(alpha);
+
+    // Camera follows the blended player, otherwise the player jitters against the world
+    updateCamera();
+}
+
+void Game::endInterpolatedRender()
+{
+    m_player.setPosition(m_tickPlayerPos);
+    m_enemyManager.restoreTickPositions();
+    m_gameView.setCenter(m_tickCameraCenter);
+}
+
+// Sleeps off whatever is left of the target frame time. sf::sleep is only ~1ms accurate
+// (worse on Windows) so it stops short and yields for the last stretch
+void Game::limitFrameRate(sf::Clock& frameClock)
+{
+    if (m_options.targetFps == 0)
+    {
+        frameClock.restart();
+        return;
+    }
+
+    const sf::Time frameBudget = sf::seconds(1.f / static_cast<float>(m_options.targetFps));
+    const sf::Time sleepMargin = sf::milliseconds(2);
+    const sf::Time elapsed = frameClock.getElapsedTime();
+
+    if (elapsed + sleepMargin < frameBudget)
+        sf::sleep(frameBudget - elapsed - sleepMargin);
+
+    while (frameClock.getElapsedTime() < frameBudget)
+        std::this_thread::yield();
+
+    frameClock.restart();
+}
+
+// ===== Threaded Simulation =====
+// Main thread draws the front snapshot while the worker steps the sim and fills the back one.
+// Nothing the worker writes is read by the main thread until wait() returns, the world layers
+// (terrain, objects) are only changed by map regen which is deferred until after the join
+void Game::runPipelinedFrame(int ticks, float alpha)
+{
+    RenderSnapshot& front = m_snapshots[m_frontSnapshot];
+    RenderSnapshot& back = m_snapshots[1 - m_frontSnapshot];
+
+    // First frame after a serial stretch (menus, pause) has nothing to draw yet
+    if (!front.valid)
+        captureSnapshot(front, alpha);
+
+    m_pendingTicks = ticks;
+    m_pendingAlpha = alpha;
+    m_simInFlight = true;
+    m_simWorker.kick();
+
+    renderSnapshot(front);
+
+    {
+        PROFILE_ZONE("Render::waitForSim");
+        m_simWorker.wait();
+    }
+    m_simInFlight = false;
+
+    // A regen or state change moved everything after the worker captured, grab it again
+    if (runDeferredActions())
+        captureSnapshot(back, alpha);
+
+    m_frontSnapshot = 1 - m_frontSnapshot;
+
+    // UI reads live sim state, safe now the worker is idle
+    m_window.setView(m_uiView);
+    {
+        PROFILE_ZONE("Render::ui");
+        m_dayTimer.render(m_window);
+        m_player.renderHUD(m_window);
+        m_player.renderInventory(m_window);
+        m_player.renderCursor(m_window);
+    }
+
+    if (m_profilerOverlay.isVisible())
+        m_profilerOverlay.render(m_window);
+
+    {
+        PROFILE_ZONE("Render::display");
+        m_window.display();
+    }
+}
+
+void Game::simulationJob()
+{
+    const sf::Time timePerFrame = sf::seconds(1.0f / 60.0f);
+
+    for (int i = 0; i < m_pendingTicks; ++i)
+    {
+        stepSimulation(timePerFrame);
+
+        // Pause or regen was queued, the rest of the ticks would run in the wrong state
+        if (!m_deferredActions.empty())
+            break;
+    }
+
+    captureSnapshot(m_snapshots[1 - m_frontSnapshot], m_pendingAlpha);
+}
+
+void Game::captureSnapshot(RenderSnapshot& snapshot, float alpha)
+{
+    PROFILE_ZONE("Sim::captureSnapshot");
+
+    const bool interpolate = m_options.interpolate
+        && m_stateManager.getCurrentState() == GameState::Playing;
+
+    if (interpolate)
+        beginInterpolatedRender(alpha);
+
+    snapshot.items.clear();
+    snapshot.entities.clear();
+    snapshot.gameView = m_gameView;
+
+    m_itemPool.captureSprites(snapshot.items, m_gameView);
+
+    if (m_player.isActive() && m_player.isValid())
+        snapshot.entities.push_back(m_player.getSpriteComponent().getSprite());
+    m_enemyManager.captureSprites(snapshot.entities);
+
+    if (interpolate)
+        endInterpolatedRender();
+
+    snapshot.valid = true;
+}
+
+// Same layers as the Playing case of render(), minus the UI
+void Game::renderSnapshot(const RenderSnapshot& snapshot)
+{
+    PROFILE_ZONE("Game::render");
+
+    m_window.clear(sf::Color::Black);
+    m_window.setView(snapshot.gameView);
+
+    if (m_map)
+    {
+        {
+            PROFILE_ZONE("Render::terrain");
+            m_map->render(m_window);
+        }
+
+        if (m_mapGenerator.getObjectPlacer())
+        {
+            PROFILE_ZONE("Render::objects");
+            m_mapGenerator.getObjectPlacer()->render(m_window, snapshot.gameView);
         }
+    }
 
-        // Render as fast as possible
-        render();
+    {
+        PROFILE_ZONE("Render::items");
+        for (const sf::Sprite& sprite : snapshot.items)
+            m_window.draw(sprite);
     }
+
+    {
+        PROFILE_ZONE("Render::entities");
+        for (const sf::Sprite& sprite : snapshot.entities)
+            m_window.draw(sprite);
+    }
+}
+
+void Game::runOnMainThread(std::function<void()> action)
+{
+    if (m_simInFlight)
+        m_deferredActions.push_back(std::move(action));
+    else
+        action();
+}
+
+bool Game::runDeferredActions()
+{
+    if (m_deferredActions.empty())
+        return false;
+
+    for (auto& action : m_deferredActions)
+        action();
+
+    m_deferredActions.clear();
+    return true;
+}
+
+// ===== Headless Loop =====
+// No window, no rendering, no frame limit. Runs headlessTicks fixed ticks and reports the rate
+void Game::runHeadless()
+{
+    const sf::Time timePerFrame = sf::seconds(1.0f / 60.0f);
+
+    // Without a replay there is nobody to click Start, go straight into the game
+    if (!m_recorder.isPlayingBack())
+    {
+        m_stateManager.changeState(GameState::Playing);
+    }
+
+    unsigned int ticks = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    while (ticks < m_options.headlessTicks && !m_exitGame)
+    {
+        Profiler::beginFrame();
+        stepSimulation(timePerFrame);
+        Profiler::endFrame();
+        ++ticks;
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const double seconds = elapsed.count();
+    const double ticksPerSecond = seconds > 0.0 ? ticks / seconds : 0.0;
+
+    // Report goes straight to stdout so build scripts can grep it
+    std::cout << "Headless: " << ticks << " ticks in " << seconds << " s ("
+        << ticksPerSecond << " ticks/s, "
+        << (ticks > 0 ? seconds * 1000.0 / ticks : 0.0) << " ms/tick, seed "
+        << m_options.seed << ", map " << m_options.mapWidth << "x" << m_options.mapHeight << ")\n";
+
+    LOG_INFO(Core, "Headless run: %u ticks, %.1f ticks/s", ticks, ticksPerSecond);
+
+    finishRecording();
+}
+
+void Game::finishRecording()
+{
+    if (!m_recorder.isRecording())
+        return;
+
+    if (m_recorder.saveRecording(m_options.recordPath))
+    {
+        LOG_INFO(Core, "Saved %zu input ticks to %s",
+            m_recorder.getFrameCount(), m_options.recordPath.c_str());
+    }
+
+    m_recorder.stop();
 }
 
 void Game::processEvents()
@@ -325,16 +791,27 @@ void Game::processEvents()
             {
                 m_settingsMenu.handleKeyPress(keyPressed->code);
             }
+            // Debug keys: F3 profiler overlay, F4 records the next 120 frames to a Chrome trace
+            else if (keyPressed->code == sf::Keyboard::Key::F3)
+            {
+                m_profilerOverlay.toggle();
+            }
+            else if (keyPressed->code == sf::Keyboard::Key::F4)
+            {
+                Profiler::beginCapture(120, "thorns_trace.json");
+            }
         }
     }
 }
 
 void Game::update(sf::Time deltaTime)
 {
+    PROFILE_ZONE("Game::update");
+
     // Handle exit request
     if (m_exitGame)
     {
-        m_window.close();
+        runOnMainThread([this]() { m_window.close(); });
         return;
     }
 
@@ -356,6 +833,8 @@ void Game::update(sf::Time deltaTime)
     case GameState::GameOver:
         break;
     }
+
+    m_profilerOverlay.update(deltaTime);
 }
 
 void Game::updateMainMenu()
@@ -378,10 +857,12 @@ void Game::updateSettings()
 
 void Game::updatePlaying(sf::Time deltaTime)
 {
+    PROFILE_ZONE("Game::updatePlaying");
     // Check for pause input
     if (m_input.wasJustPressed(InputAction::Pause) || m_input.wasJustPressed(InputAction::Menu))
     {
-        m_stateManager.pushState(GameState::Paused);  // Push so we can pop back
+        // Push so we can pop back. Changing state shows the OS cursor so it waits for the main thread
+        runOnMainThread([this]() { m_stateManager.pushState(GameState::Paused); });
         return;
     }
 
@@ -430,6 +911,7 @@ void Game::updatePlaying(sf::Time deltaTime)
     // ========== Item Pickup ==========
     // Radius check to collect items in world
     {
+        PROFILE_ZONE("Game::itemPickup");
         sf::FloatRect playerBounds = m_player.getBounds();
         auto activeItems = m_itemPool.getActiveItems();
 
@@ -447,7 +929,7 @@ void Game::updatePlaying(sf::Time deltaTime)
             if (m_player.collectItem(*data, m_itemPool.getAtlas()))
             {
                 m_itemPool.despawn(item);
-                std::cout << "Picked up: " << data->name << "\n";
+                LOG_INFO(Items, "Picked up: %s", data->name.c_str());
             }
         }
     }
@@ -478,6 +960,8 @@ void Game::updatePaused()
 // ======================== PN REMOVE THE SITES USED FOR RENDERING WHEN NEAR DONE IN TESTING ========================================
 void Game::render()
 {
+    PROFILE_ZONE("Game::render");
+
     m_window.clear(sf::Color::Black);
 
     // Get current and previous states for context-aware rendering
@@ -521,31 +1005,44 @@ void Game::render()
 
         if (m_map) {
             // Layer 1: The Terrain
-            m_map->render(m_window);
+            {
+                PROFILE_ZONE("Render::terrain");
+                m_map->render(m_window);
+            }
 
             // Layer 2: Objects like rocks and trees
             if (m_mapGenerator.getObjectPlacer())
             {
+                PROFILE_ZONE("Render::objects");
                 m_mapGenerator.getObjectPlacer()->render(m_window, m_gameView);
             }
         }
 
         // Item pool
-        m_itemPool.render(m_window, m_gameView);
+        {
+            PROFILE_ZONE("Render::items");
+            m_itemPool.render(m_window, m_gameView);
+        }
 
         // To be removed, Layer 3 Voronoi
         //m_mapGenerator.getVoronoiDiagram()->renderDebug(m_window);
 
         //Entities
-        m_player.render(m_window);
-        m_enemyManager.renderAll(m_window);
+        {
+            PROFILE_ZONE("Render::entities");
+            m_player.render(m_window);
+            m_enemyManager.renderAll(m_window);
+        }
 
         // For UI spacing
         m_window.setView(m_uiView);
-        m_dayTimer.render(m_window);
-        m_player.renderHUD(m_window);
-        m_player.renderInventory(m_window);
-        m_player.renderCursor(m_window);
+        {
+            PROFILE_ZONE("Render::ui");
+            m_dayTimer.render(m_window);
+            m_player.renderHUD(m_window);
+            m_player.renderInventory(m_window);
+            m_player.renderCursor(m_window);
+        }
 
         break;
 
@@ -576,7 +1073,17 @@ void Game::render()
         break;
     }
 
-    m_window.display();
+    // Profiler sits on top of everything in every state
+    if (m_profilerOverlay.isVisible())
+    {
+        m_window.setView(m_uiView);
+        m_profilerOverlay.render(m_window);
+    }
+
+    {
+        PROFILE_ZONE("Render::display");
+        m_window.display();
+    }
 }
 
 // ========== State Transition Callbacks ==========
@@ -672,6 +1179,9 @@ void Game::onApplySettings()
     const auto& res = m_screenSettings.getCurrentResolution();
     m_settingsMenu.updateLayout(res.width, res.height);
 
+    // Window was recreated, vsync doesn't carry over
+    m_window.setVerticalSyncEnabled(m_options.vsync);
+
     std::cout << "Settings applied!" << std::endl;
 }
 
@@ -708,13 +1218,26 @@ sf::Vector2f Game::clampCameraToMapBounds(const sf::Vector2f& targetPos)
 
 sf::Vector2f Game::getMousePosition() const
 {
-    // Convert window-relative mouse position to Vector2f for button checks
-    return sf::Vector2f(sf::Mouse::getPosition(m_window));
+    // Window-relative mouse position sampled this tick (live or replayed)
+    return m_input.getMousePosition();
 }
 
 sf::Vector2f Game::getMouseWorldPosition() const
 {
+    const sf::Vector2f mousePixel = m_input.getMousePosition();
+
+    // Headless has no window to map through, use the viewport the input was recorded against
+    if (m_options.headless)
+    {
+        const InputRecorder::SessionInfo& info = m_recorder.getSessionInfo();
+        const sf::Vector2f viewSize = m_gameView.getSize();
+        const sf::Vector2f topLeft = m_gameView.getCenter() - viewSize / 2.f;
+
+        return sf::Vector2f(
+            topLeft.x + mousePixel.x * (viewSize.x / info.viewportWidth),
+            topLeft.y + mousePixel.y * (viewSize.y / info.viewportHeight));
+    }
+
     // Convert screen coordinates to world coordinates using game view
-    sf::Vector2i mousePixel = sf::Mouse::getPosition(m_window);
-    return m_window.mapPixelToCoords(mousePixel, m_gameView);
+    return m_window.mapPixelToCoords(sf::Vector2i(mousePixel), m_gameView);
 }
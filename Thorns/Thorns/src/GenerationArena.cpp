@@ -0,0 +1,54 @@
+#include "GenerationArena.h"
+#include "Logger.h"
+
+GenerationArena::GenerationArena(size_t initialCapacity)
+    : m_buffer(initialCapacity)
+{
+    m_resource.emplace(m_buffer.data(), m_buffer.size(), std::pmr::new_delete_resource());
+}
+
+void GenerationArena::reset()
+{
+    // Last run spilled to the heap, grow so the next one fits. A quarter over so a slightly
+    // bigger map doesn't spill again straight away
+    if (m_bytesUsed > m_buffer.size())
+    {
+        const size_t grown = m_bytesUsed + m_bytesUsed / 4;
+        LOG_DEBUG(MapGen, "GenerationArena: %zu bytes used, growing buffer %zu -> %zu",
+            m_bytesUsed, m_buffer.size(), grown);
+
+        m_resource.reset();
+        m_buffer.assign(grown, std::byte{ 0 });
+        m_resource.emplace(m_buffer.data(), m_buffer.size(), std::pmr::new_delete_resource());
+    }
+    else
+    {
+        // Frees any upstream blocks and rewinds to the start of the buffer
+        m_resource->release();
+    }
+
+    m_bytesUsed = 0;
+}
+
+void* GenerationArena::do_allocate(size_t bytes, size_t alignment)
+{
+    // Alignment padding is counted too, it still takes room in the buffer
+    m_bytesUsed += bytes + alignment - 1;
+    if (m_bytesUsed > m_peakBytes)
+        m_peakBytes = m_bytesUsed;
+
+    return m_resource->allocate(bytes, alignment);
+}
+
+// Personal Notes Generation Arena:
+/*
+    std::pmr: https://en.cppreference.com/w/cpp/memory/monotonic_buffer_resource
+    Containers take a memory_resource* instead of a template allocator, so a pmr::vector<int>
+    from the arena is the same type as one from the heap and passes through the same functions.
+
+    Why monotonic: a generation only ever builds its temporaries up and throws them all away
+    at the end, so freeing them one by one is wasted work. Same idea as a per frame allocator.
+
+    Catch: a vector that regrows leaves its old block behind until reset, so reserve() up front
+    where the size is known (Poisson maxPoints, site counts).
+*/
@@ -0,0 +1,188 @@
+#include "GenerationCache.h"
+#include "MapSnapshot.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+
+GenerationCache::GenerationCache(const std::string& directory, size_t memoryEntries)
+    : m_memoryEntries(memoryEntries > 0 ? memoryEntries : 1)
+    , m_directory(directory)
+    , m_diskEnabled(true)
+    , m_writing(false)
+    , m_quit(false)
+{
+    m_writer = std::thread(&GenerationCache::writerMain, this);
+}
+
+GenerationCache::~GenerationCache()
+{
+    // Queued writes still land, a half written cache file would just be a miss next run anyway
+    {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        m_quit = true;
+    }
+    m_writeCondition.notify_one();
+    m_writer.join();
+}
+
+// ========================================================================================================
+// LOOKUP / STORE
+// ========================================================================================================
+bool GenerationCache::find(std::uint64_t key, MapSnapshot& out)
+{
+    PROFILE_ZONE("GenerationCache::find");
+
+    // Memory first
+    auto it = m_lookup.find(key);
+    if (it != m_lookup.end())
+    {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+        std::vector<std::uint8_t> bytes(*it->second->bytes);
+        if (out.loadBytes(std::move(bytes)))
+        {
+            ++m_stats.memoryHits;
+            LOG_DEBUG(MapGen, "Generation cache: memory hit %016llx", static_cast<unsigned long long>(key));
+            return true;
+        }
+
+        // Can only fail if something scribbled on the entry, drop it
+        m_entries.erase(it->second);
+        m_lookup.erase(it);
+    }
+
+    if (!m_diskEnabled)
+    {
+        ++m_stats.misses;
+        return false;
+    }
+
+    // Then disk
+    const std::string path = pathFor(key);
+    std::error_code error;
+    if (!std::filesystem::exists(path, error))
+    {
+        ++m_stats.misses;
+        return false;
+    }
+
+    if (!out.loadFile(path))
+    {
+        // Old version or corrupt, it'll be rewritten after this generation
+        std::filesystem::remove(path, error);
+        ++m_stats.misses;
+        return false;
+    }
+
+    ++m_stats.diskHits;
+    LOG_DEBUG(MapGen, "Generation cache: disk hit %s", path.c_str());
+
+    // Promote so the next hit skips the file system
+    const std::uint8_t* data = out.getBytes();
+    insertMemory(key, std::make_shared<const std::vector<std::uint8_t>>(data, data + out.getByteSize()));
+    return true;
+}
+
+void GenerationCache::store(std::uint64_t key, std::vector<std::uint8_t>&& bytes)
+{
+    if (bytes.empty())
+        return;
+
+    Bytes shared = std::make_shared<const std::vector<std::uint8_t>>(std::move(bytes));
+    insertMemory(key, shared);
+    ++m_stats.stores;
+
+    if (!m_diskEnabled)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        m_pendingWrites.push_back({ pathFor(key), std::move(shared) });
+    }
+    m_writeCondition.notify_one();
+}
+
+void GenerationCache::clearMemory()
+{
+    m_entries.clear();
+    m_lookup.clear();
+}
+
+void GenerationCache::flush()
+{
+    std::unique_lock<std::mutex> lock(m_writeMutex);
+    m_idleCondition.wait(lock, [this]() { return m_pendingWrites.empty() && !m_writing; });
+}
+
+// ========================================================================================================
+// INTERNALS
+// ========================================================================================================
+std::string GenerationCache::pathFor(std::uint64_t key) const
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.thms", static_cast<unsigned long long>(key));
+    return m_directory + "/" + name;
+}
+
+void GenerationCache::insertMemory(std::uint64_t key, Bytes bytes)
+{
+    auto it = m_lookup.find(key);
+    if (it != m_lookup.end())
+    {
+        it->second->bytes = std::move(bytes);
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    m_entries.push_front({ key, std::move(bytes) });
+    m_lookup[key] = m_entries.begin();
+
+    // Evict least recently used, the disk copy (if any) stays
+    while (m_entries.size() > m_memoryEntries)
+    {
+        m_lookup.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+}
+
+void GenerationCache::writerMain()
+{
+    std::unique_lock<std::mutex> lock(m_writeMutex);
+
+    while (true)
+    {
+        m_writeCondition.wait(lock, [this]() { return !m_pendingWrites.empty() || m_quit; });
+
+        if (m_pendingWrites.empty() && m_quit)
+            break;
+
+        PendingWrite write = std::move(m_pendingWrites.front());
+        m_pendingWrites.pop_front();
+        m_writing = true;
+
+        // File IO runs unlocked so store() never waits on the disk
+        lock.unlock();
+        {
+            std::error_code error;
+            std::filesystem::create_directories(m_directory, error);
+
+            // Write beside it then rename, a reader never maps a half written file
+            const std::string tempPath = write.path + ".tmp";
+            if (MapSnapshot::writeFile(tempPath, *write.bytes))
+            {
+                std::filesystem::rename(tempPath, write.path, error);
+                if (error)
+                {
+                    std::cerr << "GenerationCache: Failed to move " << tempPath << " into place\n";
+                    std::filesystem::remove(tempPath, error);
+                }
+            }
+        }
+        lock.lock();
+
+        m_writing = false;
+        m_idleCondition.notify_all();
+    }
+}
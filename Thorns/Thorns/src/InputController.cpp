@@ -7,8 +7,14 @@ InputController::InputController()
     : m_mousePosition(0.f, 0.f)
     , m_leftMousePressed(false)
     , m_previousLeftMousePressed(false)
+    , m_rightMousePressed(false)
+    , m_previousRightMousePressed(false)
     , m_activeDevice(InputDevice::Keyboard)
 {
+    // Start from a known state so the first tick of a replay matches the recording
+    std::memset(m_currentState, 0, sizeof(m_currentState));
+    std::memset(m_previousState, 0, sizeof(m_previousState));
+
     initializeDefaultBindings();
 
     // Check if gamepad is already connected at startup
@@ -47,67 +53,102 @@ void InputController::detectActiveDevice()
 }
 
 /// <summary>
-/// Updating the input states and events
+/// Reading the devices into a frame, the input state itself isn't touched
 /// 
 /// Flow: 
-/// 1: Save current state to previous state (for comparisons)
-/// 2: Clear Current state
-/// 3: Check if a gamepad was connected
-/// 4: Update only what device is connected
+/// 1: Check if a gamepad was connected
+/// 2: Poll only what device is connected
+/// 3: Mouse always
 /// </summary>
-void InputController::update(const sf::Window& window)
+InputFrame InputController::pollFrame(const sf::Window& window)
 {
-    // ===== STEP 1: SAVE PREVIOUS STATE =====
-    // Copy current -> previous
-    // Example: If W was pressed last frame and this frame,
-    //          wasJustPressed() returns false
-    std::memcpy(m_previousState, m_currentState, sizeof(m_currentState));
-    m_previousLeftMousePressed = m_leftMousePressed;
-    m_previousRightMousePressed = m_rightMousePressed;
-
-    // ===== STEP 2: CLEAR CURRENT STATE =====
-    // Reset all actions to false
-    std::memset(m_currentState, 0, sizeof(m_currentState));
-
-    // ===== STEP 3: DETECT DEVICE CHANGES =====
+    // ===== STEP 1: DETECT DEVICE CHANGES =====
     // Check if gamepad was plugged in or unplugged
     detectActiveDevice();
 
-    // ===== STEP 4: POLL ACTIVE INPUT DEVICE =====
+    // Starts with every action false
+    InputFrame frame;
+
+    // ===== STEP 2: POLL ACTIVE INPUT DEVICE =====
     // Only check the device that's currently active
     switch (m_activeDevice)
     {
     case InputDevice::Gamepad:
-        updateGamepad();
+        updateGamepad(frame);
         break;
     case InputDevice::Keyboard:
-        updateKeyboard();
+        updateKeyboard(frame);
         break;
     default: std::cout << "Unkown Input Device\n";
     }
 
+    // ===== STEP 3: MOUSE =====
     // Always update mouse (used in both modes, just in case as a fallback)
-    updateMouse(window);
+    updateMouse(window, frame);
+    return frame;
+}
+
+// Live input goes through the same step as a replayed frame, so the two can't drift apart
+void InputController::update(const sf::Window& window)
+{
+    applyFrame(pollFrame(window));
+}
+
+// ========== Replay ==========
+InputFrame InputController::captureFrame() const
+{
+    InputFrame frame;
+
+    for (int i = 0; i < static_cast<int>(InputAction::COUNT); ++i)
+    {
+        if (m_currentState[i])
+            frame.actionBits |= static_cast<std::uint16_t>(1u << i);
+    }
+
+    if (m_leftMousePressed)  frame.mouseButtons |= 0x1;
+    if (m_rightMousePressed) frame.mouseButtons |= 0x2;
+
+    frame.mouseX = m_mousePosition.x;
+    frame.mouseY = m_mousePosition.y;
+    return frame;
+}
+
+void InputController::applyFrame(const InputFrame& frame)
+{
+    // Step 1: Save previous state (same as update)
+    std::memcpy(m_previousState, m_currentState, sizeof(m_currentState));
+    m_previousLeftMousePressed = m_leftMousePressed;
+    m_previousRightMousePressed = m_rightMousePressed;
+
+    // Step 2: Unpack the recorded frame
+    for (int i = 0; i < static_cast<int>(InputAction::COUNT); ++i)
+    {
+        m_currentState[i] = (frame.actionBits & (1u << i)) != 0;
+    }
+
+    m_leftMousePressed = (frame.mouseButtons & 0x1) != 0;
+    m_rightMousePressed = (frame.mouseButtons & 0x2) != 0;
+    m_mousePosition = sf::Vector2f(frame.mouseX, frame.mouseY);
 }
 
 /*
 *UPDATE KEYBOARD
 *
-* Polls keyboard input and updates m_currentState array.
+* Polls keyboard input and sets the frame's action bits.
 * Only called when InputDevice::Keyboard is active.
 *
 * Iterates through all key bindings and checks if each key is pressed.
 * Example: If W is bound to MoveUp and W is pressed,
 * m_currentState[MoveUp] = true
 */
-void InputController::updateKeyboard()
+void InputController::updateKeyboard(InputFrame& frame) const
 {
     // Check all key bindings
     for (const auto& [action, key] : m_keyBindings)
     {
         if (sf::Keyboard::isKeyPressed(key))
         {
-            m_currentState[static_cast<int>(action)] = true;
+            setAction(frame, action);
         }
     }
 }
@@ -115,12 +156,12 @@ void InputController::updateKeyboard()
 /*
  * UPDATE GAMEPAD
  *
- * Polls gamepad input (analog sticks + buttons) and updates m_currentState.
+ * Polls gamepad input (analog sticks + buttons) and sets the frame's action bits.
  * Only called when InputDevice::Gamepad is active.
  *
  * Note: Analog stick values are converted to digital (on/off) actions.
  */
-void InputController::updateGamepad()
+void InputController::updateGamepad(InputFrame& frame) const
 {
     // ===== ANALOG STICK -> DIGITAL ACTIONS =====
     // Get stick position (-100 to +100, SFML's range)
@@ -135,10 +176,10 @@ void InputController::updateGamepad()
     // Convert analog to digital (threshold = 0.5)
     // Example: If stick is pushed 60% left, x = -0.6, MoveLeft = true
     float threeshold = 0.5f;
-    if (x < -threeshold) m_currentState[static_cast<int>(InputAction::MoveLeft)] = true;
-    if (x > threeshold)  m_currentState[static_cast<int>(InputAction::MoveRight)] = true;
-    if (y < -threeshold) m_currentState[static_cast<int>(InputAction::MoveUp)] = true;
-    if (y > threeshold)  m_currentState[static_cast<int>(InputAction::MoveDown)] = true;
+    if (x < -threeshold) setAction(frame, InputAction::MoveLeft);
+    if (x > threeshold)  setAction(frame, InputAction::MoveRight);
+    if (y < -threeshold) setAction(frame, InputAction::MoveUp);
+    if (y > threeshold)  setAction(frame, InputAction::MoveDown);
 
     // ===== GAMEPAD BUTTONS =====
     // Button mapping (Xbox):
@@ -146,26 +187,28 @@ void InputController::updateGamepad()
     // 1 = B/Circle (Cancel)
     // 7 = Start (Pause)
     if (sf::Joystick::isButtonPressed(m_activeGamepad, 0))
-        m_currentState[static_cast<int>(InputAction::Confirm)] = true;
+        setAction(frame, InputAction::Confirm);
     if (sf::Joystick::isButtonPressed(m_activeGamepad, 1))
-        m_currentState[static_cast<int>(InputAction::Cancel)] = true;
+        setAction(frame, InputAction::Cancel);
     if (sf::Joystick::isButtonPressed(m_activeGamepad, 7))
-        m_currentState[static_cast<int>(InputAction::Pause)] = true;
+        setAction(frame, InputAction::Pause);
 }
 
 
-void InputController::updateMouse(const sf::Window& window)
+void InputController::updateMouse(const sf::Window& window, InputFrame& frame) const
 {
     // Get mouse position relative to window
     sf::Vector2i pixelPos = sf::Mouse::getPosition(window);
-    m_mousePosition = sf::Vector2f(static_cast<float>(pixelPos.x),
-        static_cast<float>(pixelPos.y));
+    frame.mouseX = static_cast<float>(pixelPos.x);
+    frame.mouseY = static_cast<float>(pixelPos.y);
 
     // Check left mouse button
-    m_leftMousePressed = sf::Mouse::isButtonPressed(sf::Mouse::Button::Left);
+    if (sf::Mouse::isButtonPressed(sf::Mouse::Button::Left))
+        frame.mouseButtons |= 0x1;
 
     // Check right mouse button
-    m_rightMousePressed = sf::Mouse::isButtonPressed(sf::Mouse::Button::Right);
+    if (sf::Mouse::isButtonPressed(sf::Mouse::Button::Right))
+        frame.mouseButtons |= 0x2;
 }
 
 float InputController::applyDeadzone(float value) const
@@ -186,6 +229,6 @@ void InputController::bindKey(InputAction action, sf::Keyboard::Key key)
 // Return currently bound key, or Unknown if not found
 sf::Keyboard::Key InputController::getKeyBinding(InputAction action) const
 {
-    auto it = m_keyBindings.find(action);
-    return it != m_keyBindings.end() ? it->second : sf::Keyboard::Key::Unknown;
-}
\ No newline at end of file
+    const sf::Keyboard::Key* key = m_keyBindings.find(action);
+    return key ? *key : sf::Keyboard::Key::Unknown;
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "InputRecorder.h"
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+    struct FileHeader
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t seed;
+        std::uint16_t mapWidth;
+        std::uint16_t mapHeight;
+        std::uint16_t viewportWidth;
+        std::uint16_t viewportHeight;
+        std::uint32_t frameCount;
+    };
+}
+
+InputRecorder::InputRecorder()
+    : m_mode(Mode::Idle)
+    , m_playbackIndex(0)
+{
+}
+
+// ========== Recording ==========
+void InputRecorder::startRecording(const SessionInfo& info)
+{
+    m_info = info;
+    m_frames.clear();
+    m_frames.reserve(60 * 60 * 5);  // 5 minutes before it needs to grow
+    m_playbackIndex = 0;
+    m_mode = Mode::Recording;
+}
+
+void InputRecorder::record(const InputFrame& frame)
+{
+    if (m_mode != Mode::Recording)
+        return;
+
+    m_frames.push_back(frame);
+}
+
+bool InputRecorder::saveRecording(const std::string& filePath) const
+{
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "InputRecorder: Failed to open " << filePath << " for writing\n";
+        return false;
+    }
+
+    FileHeader header{};
+    header.magic = FILE_MAGIC;
+    header.version = FILE_VERSION;
+    header.seed = m_info.seed;
+    header.mapWidth = m_info.mapWidth;
+    header.mapHeight = m_info.mapHeight;
+    header.viewportWidth = m_info.viewportWidth;
+    header.viewportHeight = m_info.viewportHeight;
+    header.frameCount = static_cast<std::uint32_t>(m_frames.size());
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_frames.data()),
+        static_cast<std::streamsize>(m_frames.size() * sizeof(InputFrame)));
+
+    if (!file.good())
+    {
+        std::cerr << "InputRecorder: Failed writing " << filePath << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+// ========== Playback ==========
+bool InputRecorder::loadRecording(const std::string& filePath)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "InputRecorder: Failed to open " << filePath << "\n";
+        return false;
+    }
+
+    FileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    if (!file.good() || header.magic != FILE_MAGIC)
+    {
+        std::cerr << "InputRecorder: " << filePath << " is not a replay file\n";
+        return false;
+    }
+
+    if (header.version != FILE_VERSION)
+    {
+        std::cerr << "InputRecorder: " << filePath << " has version " << header.version
+            << ", expected " << FILE_VERSION << "\n";
+        return false;
+    }
+
+    m_frames.resize(header.frameCount);
+    file.read(reinterpret_cast<char*>(m_frames.data()),
+        static_cast<std::streamsize>(m_frames.size() * sizeof(InputFrame)));
+
+    if (!file.good())
+    {
+        std::cerr << "InputRecorder: " << filePath << " is truncated\n";
+        m_frames.clear();
+        return false;
+    }
+
+    m_info.seed = header.seed;
+    m_info.mapWidth = header.mapWidth;
+    m_info.mapHeight = header.mapHeight;
+    m_info.viewportWidth = header.viewportWidth;
+    m_info.viewportHeight = header.viewportHeight;
+
+    m_playbackIndex = 0;
+    m_mode = Mode::Playback;
+    return true;
+}
+
+bool InputRecorder::nextFrame(InputFrame& outFrame)
+{
+    if (m_mode != Mode::Playback || m_playbackIndex >= m_frames.size())
+        return false;
+
+    outFrame = m_frames[m_playbackIndex++];
+    return true;
+}
@@ -247,14 +247,19 @@ bool Inventory::addItem(const std::string& itemName, const std::string& textureP
             slot.item->texturePath = texturePath;
             slot.item->quantity = quantity;
 
-            // Load texture using SpriteComponent
-            if (!slot.item->sprite.loadTexture(texturePath, SLOT_SIZE * 0.8f, SLOT_SIZE * 0.8f))
+            // Own texture for this item, the sprite just views it
+            slot.item->ownedTexture = std::make_unique<sf::Texture>();
+            if (!slot.item->ownedTexture->loadFromFile(texturePath))
             {
                 std::cerr << "Failed to load item texture: " << texturePath << std::endl;
                 slot.item.reset();
                 return false;
             }
 
+            const sf::Vector2i textureSize(slot.item->ownedTexture->getSize());
+            slot.item->sprite.setTexture(*slot.item->ownedTexture, SLOT_SIZE * 0.8f, SLOT_SIZE * 0.8f,
+                sf::IntRect(sf::Vector2i(0, 0), textureSize));
+
             slot.background.setFillColor(m_filledSlotColor);
             return true;
         }
@@ -276,10 +281,10 @@ bool Inventory::addItem(const std::string& itemName, const sf::Texture& atlas, c
             slot.item->itemType = itemType;
             slot.item->quantity = quantity;
 
-            if (!slot.item->sprite.setSharedTexture(atlas,
+            if (!slot.item->sprite.setTexture(atlas,
                 SLOT_SIZE * 0.8f, SLOT_SIZE * 0.8f, atlasRect))
             {
-                std::cerr << "Inventory::addItem: setSharedTexture failed for "
+                std::cerr << "Inventory::addItem: setTexture failed for "
                     << itemName << "\n";
                 slot.item.reset();
                 return false;
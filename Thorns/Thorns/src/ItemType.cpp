@@ -1,8 +1,13 @@
 #include "ItemType.h"
+#include "AssetTables.h"
+#include "Logger.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
 
+static_assert(std::size(AssetTables::ITEM_ATLAS) == static_cast<size_t>(ItemType::COUNT),
+    "items_atlas.txt is missing an ItemType, update Tools/generate_asset_tables.py and rerun it");
+
 ItemTypeRegistry::ItemTypeRegistry()
 {
     registerDefaults();
@@ -10,124 +15,43 @@ ItemTypeRegistry::ItemTypeRegistry()
 
 void ItemTypeRegistry::registerDefaults()
 {
-    // Gameplay data only
-
-    // ========== FOOD ==========
-    ItemTypeData food;
-    food.itemType = ItemType::Food;
-    food.useCategory = ItemUseCategory::Consume;
-    food.name = "Food";
-    food.atlasKey = "food-tin";
-    food.spriteSize = sf::Vector2f(32.f, 32.f);  // World render size
-    food.statRestoreAmount = 30.f;               // Restores 30 hunger on use
-    food.pickupRadius = 32.f;
-    registerType(ItemType::Food, food);
-
-    // ========== WATER ==========
-    ItemTypeData water;
-    water.itemType = ItemType::Water;
-    water.useCategory = ItemUseCategory::Consume;
-    water.name = "Water";
-    water.atlasKey = "water-bottle";
-    water.spriteSize = sf::Vector2f(32.f, 32.f);
-    water.statRestoreAmount = 40.f;               // Restores 40 water on use
-    water.pickupRadius = 32.f;
-    registerType(ItemType::Water, water);
-
-    // ========== FIRST AID ==========
-    ItemTypeData firstAid;
-    firstAid.itemType = ItemType::FirstAid;
-    firstAid.useCategory = ItemUseCategory::Consume;
-    firstAid.name = "First Aid";
-    firstAid.atlasKey = "medkit";
-    firstAid.spriteSize = sf::Vector2f(32.f, 32.f);
-    firstAid.statRestoreAmount = 100.f;  // Full heal
-    firstAid.pickupRadius = 32.f;
-    registerType(ItemType::FirstAid, firstAid);
-
-    // ========== BANDAGE ==========
-    ItemTypeData bandage;
-    bandage.itemType = ItemType::Bandage;
-    bandage.useCategory = ItemUseCategory::Consume;
-    bandage.name = "Bandage";
-    bandage.atlasKey = "bandage";
-    bandage.spriteSize = sf::Vector2f(32.f, 32.f);
-    bandage.statRestoreAmount = 35.f;
-    bandage.pickupRadius = 32.f;
-    registerType(ItemType::Bandage, bandage);
-
-    // ========== KNIFE ==========
-    ItemTypeData knife;
-    knife.itemType = ItemType::Knife;
-    knife.useCategory = ItemUseCategory::Equip;
-    knife.name = "Knife";
-    knife.atlasKey = "knife";
-    knife.spriteSize = sf::Vector2f(32.f, 32.f);
-    knife.damage = 25.f;
-    knife.pickupRadius = 32.f;
-    registerType(ItemType::Knife, knife);
-
-    // ========== AXE ==========
-    ItemTypeData axe;
-    axe.itemType = ItemType::Axe;
-    axe.useCategory = ItemUseCategory::Equip;
-    axe.name = "Axe";
-    axe.atlasKey = "fire-axe";
-    axe.spriteSize = sf::Vector2f(32.f, 32.f);
-    axe.damage = 50.f;
-    axe.pickupRadius = 32.f;
-    registerType(ItemType::Axe, axe);
-
-    // ========== GUN ==========
-    ItemTypeData gun;
-    gun.itemType = ItemType::Gun;
-    gun.useCategory = ItemUseCategory::Equip;
-    gun.name = "Gun";
-    gun.atlasKey = "pistol";
-    gun.spriteSize = sf::Vector2f(32.f, 32.f);
-    gun.damage = 75.f;
-    gun.pickupRadius = 32.f;
-    registerType(ItemType::Gun, gun);
+    // Gameplay numbers from ITEM_STATS, atlas rects from the generated table
+    for (size_t i = 0; i < EnumMap<ItemType, ItemTypeData>::CAPACITY; ++i)
+    {
+        const ItemStats& stats = ITEM_STATS[i];
+        const AssetTables::AtlasEntry& atlas = AssetTables::ITEM_ATLAS[i];
+
+        ItemTypeData& data = m_data[static_cast<ItemType>(i)];
+        data.itemType = static_cast<ItemType>(i);
+        data.useCategory = stats.useCategory;
+        data.name = stats.name;
+        data.atlasKey = atlas.key;
+        data.atlasRect = sf::IntRect(sf::Vector2i(atlas.x, atlas.y), sf::Vector2i(atlas.width, atlas.height));
+        data.spriteSize = sf::Vector2f(stats.spriteSize, stats.spriteSize);
+        data.statRestoreAmount = stats.statRestoreAmount;
+        data.damage = stats.damage;
+        data.pickupRadius = stats.pickupRadius;
+    }
 }
 
 const ItemTypeData* ItemTypeRegistry::get(ItemType type) const
 {
-    auto it = m_data.find(type);
-    if (it != m_data.end())
-        return &it->second;
-    return nullptr;
+    return m_data.find(type);
 }
 
 bool ItemTypeRegistry::has(ItemType type) const
 {
-    return m_data.find(type) != m_data.end();
-}
-
-void ItemTypeRegistry::registerType(ItemType type, const ItemTypeData& data)
-{
-    m_data[type] = data;
+    return m_data.contains(type);
 }
 
 bool ItemTypeRegistry::keyToType(const std::string& key, ItemType& outType)
 {
-    // Maps txt name column -> ItemType enum.
-    // PN: Need to add the rest when ready
-    static const std::pair<const char*, ItemType> table[] =
-    {
-        { "food-tin",      ItemType::Food   },
-        { "water-bottle",  ItemType::Water  },
-        { "medkit",   ItemType::FirstAid },
-        { "bandage",     ItemType::Bandage  },
-        { "knife",       ItemType::Knife    },
-        { "fire-axe",         ItemType::Axe      },
-        { "pistol",         ItemType::Gun      },
-    };
-
-    for (const auto& [k, t] : table)
+    // Maps txt name column -> ItemType enum, keys live in the generated table
+    for (size_t i = 0; i < std::size(AssetTables::ITEM_ATLAS); ++i)
     {
-        if (key == k)
+        if (key == AssetTables::ITEM_ATLAS[i].key)
         {
-            outType = t;
+            outType = static_cast<ItemType>(i);
             return true;
         }
     }
@@ -136,6 +60,11 @@ bool ItemTypeRegistry::keyToType(const std::string& key, ItemType& outType)
 
 bool ItemTypeRegistry::loadDefinitions(const std::string& definitionsPath)
 {
+#ifndef _DEBUG
+    // Rects are already in from AssetTables.h
+    (void)definitionsPath;
+    return true;
+#else
     std::ifstream file(definitionsPath);
     if (!file.is_open())
     {
@@ -170,17 +99,21 @@ bool ItemTypeRegistry::loadDefinitions(const std::string& definitionsPath)
         if (!keyToType(name, type))
             continue;   // Not an item to care about (for now until testing it done)
 
-        auto it = m_data.find(type);
-        if (it == m_data.end())
-            continue;
+        const sf::IntRect rect(sf::Vector2i(x, y), sf::Vector2i(w, h));
+        ItemTypeData& data = m_data[type];
 
-        it->second.atlasRect = sf::IntRect(sf::Vector2i(x, y), sf::Vector2i(w, h));
-        std::cout << "ItemTypeRegistry: Loaded rect for '" << name
-            << "' [" << x << "," << y << " " << w << "x" << h << "]\n";
+        // File wins in debug so atlas edits show up straight away, but flag the stale header
+        if (data.atlasRect != rect)
+        {
+            LOG_WARN(Items, "items_atlas.txt '%s' differs from AssetTables.h, rerun Tools/generate_asset_tables.py",
+                name.c_str());
+            data.atlasRect = rect;
+        }
         ++loaded;
     }
 
-    std::cout << "ItemTypeRegistry: " << loaded << " atlas rect(s) loaded from "
+    std::cout << "ItemTypeRegistry: " << loaded << " atlas rect(s) checked against "
         << definitionsPath << "\n";
     return loaded > 0;
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include "JobSystem.h"
+#include "Logger.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// INTERNAL STATE
+// ============================================================================
+namespace
+{
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<JobSystem::Job> jobs;
+    };
+
+    struct JobSystemState
+    {
+        // Slot 0 is shared by every thread that isn't a worker, worker n owns slot n
+        std::vector<std::unique_ptr<WorkQueue>> queues;
+        std::vector<std::thread> workers;
+
+        std::atomic<bool> running{ false };
+        std::atomic<bool> quit{ false };
+
+        // Sleeping workers, run() skips the notify when nobody is waiting
+        std::mutex sleepMutex;
+        std::condition_variable wakeCondition;
+        std::atomic<int> sleeping{ 0 };
+        std::atomic<int> queued{ 0 };
+    };
+
+    JobSystemState& state()
+    {
+        static JobSystemState s;
+        return s;
+    }
+
+    // Queue slot of the current thread, 0 for anything that isn't a worker
+    thread_local size_t t_queueIndex = 0;
+
+    void push(JobSystemState& s, const JobSystem::Job& job)
+    {
+        WorkQueue& queue = *s.queues[t_queueIndex];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(job);
+        }
+        // seq_cst pairs with the sleeper bumping sleeping then re-checking queued, one of the
+        // two always sees the other so a wake up can't be missed
+        s.queued.fetch_add(1);
+
+        if (s.sleeping.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(s.sleepMutex);
+            s.wakeCondition.notify_one();
+        }
+    }
+
+    // Own queue from the back, then steal from the front of the others, starting after our own
+    bool pop(JobSystemState& s, JobSystem::Job& out)
+    {
+        if (s.queued.load(std::memory_order_acquire) <= 0)
+            return false;
+
+        const size_t queueCount = s.queues.size();
+        for (size_t i = 0; i < queueCount; ++i)
+        {
+            const size_t index = (t_queueIndex + i) % queueCount;
+            WorkQueue& queue = *s.queues[index];
+
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.jobs.empty())
+                continue;
+
+            if (i == 0)
+            {
+                out = queue.jobs.back();
+                queue.jobs.pop_back();
+            }
+            else
+            {
+                out = queue.jobs.front();
+                queue.jobs.pop_front();
+            }
+
+            s.queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        return false;
+    }
+
+    void execute(const JobSystem::Job& job)
+    {
+        job.function(job.context, job.begin, job.end);
+
+        // Last touch of the counter, a waiter can free it the moment it reads 0. Release so the
+        // job's writes are visible to whoever sees it done
+        if (job.counter)
+            job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void workerMain(size_t queueIndex)
+    {
+        t_queueIndex = queueIndex;
+        JobSystemState& s = state();
+
+        JobSystem::Job job;
+        while (!s.quit.load(std::memory_order_acquire))
+        {
+            if (pop(s, job))
+            {
+                execute(job);
+                continue;
+            }
+
+            // Nothing anywhere, sleep until run() or shutdown() wakes us
+            std::unique_lock<std::mutex> lock(s.sleepMutex);
+            s.sleeping.fetch_add(1);
+            s.wakeCondition.wait(lock, [&s]()
+            {
+                    return s.quit.load(std::memory_order_acquire) || s.queued.load() > 0;
+            });
+            s.sleeping.fetch_sub(1);
+        }
+    }
+}
+
+// ============================================================================
+// LIFETIME
+// ============================================================================
+bool JobSystem::initialize(unsigned int workerCount)
+{
+    JobSystemState& s = state();
+    if (s.running.load(std::memory_order_acquire))
+        return true;
+
+    if (workerCount == 0)
+    {
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    s.quit.store(false, std::memory_order_release);
+    s.queued.store(0, std::memory_order_release);
+    s.queues.clear();
+    for (unsigned int i = 0; i <= workerCount; ++i)
+        s.queues.push_back(std::make_unique<WorkQueue>());
+
+    s.running.store(true, std::memory_order_release);
+
+    s.workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i)
+        s.workers.emplace_back(workerMain, static_cast<size_t>(i + 1));
+
+    LOG_INFO(Core, "JobSystem: %u worker threads", workerCount);
+    return true;
+}
+
+void JobSystem::shutdown()
+{
+    JobSystemState& s = state();
+    if (!s.running.load(std::memory_order_acquire))
+        return;
+
+    // Anything still queued gets run here, nobody is left waiting on a half done counter
+    Job job;
+    while (pop(s, job))
+        execute(job);
+
+    {
+        std::lock_guard<std::mutex> lock(s.sleepMutex);
+        s.quit.store(true, std::memory_order_release);
+    }
+    s.wakeCondition.notify_all();
+
+    for (auto& worker : s.workers)
+        worker.join();
+
+    s.workers.clear();
+    s.running.store(false, std::memory_order_release);
+    s.queues.clear();
+}
+
+bool JobSystem::isRunning()
+{
+    return state().running.load(std::memory_order_acquire);
+}
+
+unsigned int JobSystem::getThreadCount()
+{
+    JobSystemState& s = state();
+    if (!s.running.load(std::memory_order_acquire))
+        return 1;
+    return static_cast<unsigned int>(s.workers.size()) + 1;
+}
+
+// ============================================================================
+// SUBMITTING
+// ============================================================================
+void JobSystem::run(const Job& job)
+{
+    JobSystemState& s = state();
+    if (job.counter)
+        job.counter->pending.fetch_add(1, std::memory_order_acq_rel);
+
+    if (!s.running.load(std::memory_order_acquire) || s.workers.empty())
+    {
+        execute(job);
+        return;
+    }
+
+    push(s, job);
+}
+
+void JobSystem::wait(Counter& counter)
+{
+    JobSystemState& s = state();
+
+    // Help while waiting, the waiting thread is just another worker until its batch is done
+    Job job;
+    while (!counter.isDone())
+    {
+        if (s.running.load(std::memory_order_acquire) && pop(s, job))
+            execute(job);
+        else
+            std::this_thread::yield();
+    }
+}
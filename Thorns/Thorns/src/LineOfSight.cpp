@@ -1,6 +1,7 @@
 #include "LineOfSight.h"
 #include "Map.h"
 #include "MapTile.h"
+#include "Profiler.h"
 #include <cmath>
 
 namespace LineOfSight
@@ -10,6 +11,8 @@ namespace LineOfSight
         const Map* map,
         float maxRange)
     {
+        PROFILE_ZONE("LineOfSight::hasLineOfSight");
+
         if (!map) return false;
 
         float dx = to.x - from.x;
@@ -37,4 +40,4 @@ namespace LineOfSight
 
         return true;
     }
-}
\ No newline at end of file
+}
\ No newline at end of file
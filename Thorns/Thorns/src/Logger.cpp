@@ -0,0 +1,264 @@
+#include "Logger.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+// ============================================================================
+// INTERNAL STATE
+// ============================================================================
+namespace
+{
+    static_assert((Logger::RING_CAPACITY & (Logger::RING_CAPACITY - 1)) == 0,
+        "RING_CAPACITY must be a power of two");
+
+    struct LogSlot
+    {
+        std::atomic<std::size_t> sequence{ 0 };
+        LogLevel level = LogLevel::Info;
+        LogCategory category = LogCategory::Core;
+        long long timeMs = 0;
+        char text[Logger::MAX_MESSAGE_LENGTH] = {};
+    };
+
+    struct LoggerState
+    {
+        LoggerState()
+        {
+            for (std::size_t i = 0; i < ring.size(); ++i)
+                ring[i].sequence.store(i, std::memory_order_relaxed);
+
+            for (auto& level : categoryLevels)
+                level.store(static_cast<unsigned char>(LogLevel::Trace), std::memory_order_relaxed);
+        }
+
+        std::array<LogSlot, Logger::RING_CAPACITY> ring;
+        std::atomic<std::size_t> writeIndex{ 0 };
+        std::size_t readIndex = 0;   // Drain thread only
+
+        std::array<std::atomic<unsigned char>, static_cast<std::size_t>(LogCategory::COUNT)> categoryLevels;
+        std::atomic<unsigned int> dropped{ 0 };
+
+        std::atomic<bool> running{ false };
+        std::thread drainThread;
+        std::ofstream file;
+        bool echoToConsole = true;
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    };
+
+    LoggerState& state()
+    {
+        static LoggerState s;
+        return s;
+    }
+
+    constexpr std::size_t RING_MASK = static_cast<std::size_t>(Logger::RING_CAPACITY) - 1;
+
+    // Pops one message and writes it out, returns false if the ring was empty
+    bool drainOne(LoggerState& s)
+    {
+        LogSlot& slot = s.ring[s.readIndex & RING_MASK];
+        std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+
+        if (seq != s.readIndex + 1)
+            return false;
+
+        char line[Logger::MAX_MESSAGE_LENGTH + 48];
+        std::snprintf(line, sizeof(line), "[%8lld ms] [%-5s] [%-7s] %s\n",
+            slot.timeMs,
+            Logger::levelName(slot.level),
+            Logger::categoryName(slot.category),
+            slot.text);
+
+        if (s.file.is_open())
+            s.file << line;
+
+        if (s.echoToConsole)
+        {
+            if (slot.level >= LogLevel::Warn)
+                std::cerr << line;
+            else
+                std::cout << line;
+        }
+
+        // Hand the slot back to producers for the next lap
+        slot.sequence.store(s.readIndex + Logger::RING_CAPACITY, std::memory_order_release);
+        ++s.readIndex;
+        return true;
+    }
+
+    void drainLoop()
+    {
+        LoggerState& s = state();
+
+        while (s.running.load(std::memory_order_acquire))
+        {
+            bool wroteAny = false;
+            while (drainOne(s))
+                wroteAny = true;
+
+            if (wroteAny)
+                s.file.flush();
+            else
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+
+        // Final flush after shutdown was requested
+        while (drainOne(s)) {}
+        s.file.flush();
+    }
+}
+
+// ============================================================================
+// LIFETIME
+// ============================================================================
+bool Logger::initialize(const std::string& filePath, bool echoToConsole)
+{
+    LoggerState& s = state();
+
+    if (s.running.load())
+        return true;
+
+    s.file.open(filePath, std::ios::out | std::ios::trunc);
+    if (!s.file.is_open())
+    {
+        std::cerr << "Logger: Failed to open log file: " << filePath << "\n";
+    }
+
+    s.echoToConsole = echoToConsole;
+    s.running.store(true, std::memory_order_release);
+    s.drainThread = std::thread(drainLoop);
+
+    LOG_INFO(Core, "Logger started (min compiled level %s)",
+        levelName(static_cast<LogLevel>(THORNS_MIN_LOG_LEVEL)));
+
+    // Still usable with console echo even if the file failed
+    return s.file.is_open();
+}
+
+void Logger::shutdown()
+{
+    LoggerState& s = state();
+
+    if (!s.running.exchange(false))
+        return;
+
+    if (s.drainThread.joinable())
+        s.drainThread.join();
+
+    unsigned int dropped = s.dropped.load();
+    if (dropped > 0 && s.file.is_open())
+        s.file << "Logger: " << dropped << " messages dropped (ring full)\n";
+
+    s.file.close();
+}
+
+// ============================================================================
+// FILTERING
+// ============================================================================
+void Logger::setCategoryLevel(LogCategory category, LogLevel level)
+{
+    if (category == LogCategory::COUNT)
+        return;
+
+    state().categoryLevels[static_cast<std::size_t>(category)]
+        .store(static_cast<unsigned char>(level), std::memory_order_relaxed);
+}
+
+LogLevel Logger::getCategoryLevel(LogCategory category)
+{
+    if (category == LogCategory::COUNT)
+        return LogLevel::Off;
+
+    return static_cast<LogLevel>(state().categoryLevels[static_cast<std::size_t>(category)]
+        .load(std::memory_order_relaxed));
+}
+
+bool Logger::isEnabled(LogCategory category, LogLevel level)
+{
+    return level != LogLevel::Off && level >= getCategoryLevel(category);
+}
+
+// ============================================================================
+// WRITING
+// ============================================================================
+void Logger::write(LogLevel level, LogCategory category, const char* format, ...)
+{
+    LoggerState& s = state();
+
+    // Claim a slot, bail out (and count it) if the drain thread is a full lap behind
+    std::size_t pos = s.writeIndex.load(std::memory_order_relaxed);
+    LogSlot* slot = nullptr;
+
+    for (;;)
+    {
+        slot = &s.ring[pos & RING_MASK];
+        std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+        if (diff == 0)
+        {
+            if (s.writeIndex.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            s.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            pos = s.writeIndex.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    slot->category = category;
+    slot->timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - s.startTime).count();
+
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(slot->text, sizeof(slot->text), format, args);
+    va_end(args);
+
+    // Publish to the drain thread
+    slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+unsigned int Logger::getDroppedCount()
+{
+    return state().dropped.load(std::memory_order_relaxed);
+}
+
+const char* Logger::levelName(LogLevel level)
+{
+    switch (level)
+    {
+    case LogLevel::Trace: return "TRACE";
+    case LogLevel::Debug: return "DEBUG";
+    case LogLevel::Info:  return "INFO";
+    case LogLevel::Warn:  return "WARN";
+    case LogLevel::Error: return "ERROR";
+    default:              return "OFF";
+    }
+}
+
+const char* Logger::categoryName(LogCategory category)
+{
+    switch (category)
+    {
+    case LogCategory::Core:    return "Core";
+    case LogCategory::MapGen:  return "MapGen";
+    case LogCategory::Objects: return "Objects";
+    case LogCategory::AI:      return "AI";
+    case LogCategory::Player:  return "Player";
+    case LogCategory::Items:   return "Items";
+    default:                   return "?";
+    }
+}
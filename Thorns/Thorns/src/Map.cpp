@@ -1,5 +1,7 @@
 #include "Map.h"
+#include "CollisionManager.h"
 #include <iostream>
+#include "Logger.h"
 
 Map::Map()
     : m_width(0)
@@ -20,16 +22,18 @@ void Map::initialize(int width, int height, float tileSize)
     // Allocate 2D grid
     m_tiles.clear();
     m_tiles.resize(m_width * m_height);
+    m_poiOccupancy.assign(m_tiles.size(), POICell());
 
     m_needsRebuild = true;
 
-    std::cout << "Map initialized: " << m_width << "x" << m_height
-        << " tiles (" << getWorldSize().x << "x" << getWorldSize().y << " pixels)\n";
+    LOG_DEBUG(MapGen, "Map initialized: %dx%d tiles (%.0fx%.0f pixels)",
+        m_width, m_height, getWorldSize().x, getWorldSize().y);
 }
 
 void Map::reset()
 {
     m_pois.clear();
+    m_poiOccupancy.assign(m_tiles.size(), POICell());
 
     // Reset all tiles
     for (auto& tile : m_tiles)
@@ -39,8 +43,9 @@ void Map::reset()
         tile.setVoronoiRegion(-1);
     }
 
+    m_boundaryLines.clear();
     m_needsRebuild = true;
-    std::cout << "Map reset: " << m_width << "x" << m_height << " tiles cleared\n";
+    LOG_DEBUG(MapGen, "Map reset: %dx%d tiles cleared", m_width, m_height);
 }
 
 // ========================================================================================================
@@ -104,9 +109,10 @@ void Map::addPOI(std::unique_ptr<PointOfInterest> poi)
 {
     if (poi)
     {
-        std::cout << "Added POI: " << poi->getName() << " at ("
-            << poi->getPosition().x << ", " << poi->getPosition().y << ")\n";
+        LOG_DEBUG(MapGen, "Added POI: %s at (%.1f, %.1f)",
+            poi->getName().c_str(), poi->getPosition().x, poi->getPosition().y);
         m_pois.push_back(std::move(poi));
+        rasterizePOI(static_cast<int>(m_pois.size()) - 1);
         m_needsRebuild = true;
     }
 }
@@ -114,52 +120,126 @@ void Map::addPOI(std::unique_ptr<PointOfInterest> poi)
 // For visual area of a POI, so the whole sprite
 bool Map::isInsidePOI(const sf::Vector2f& worldPos) const
 {
-    for (const auto& poi : m_pois)
-    {
-        if (poi->getVisualBounds().contains(worldPos))
-            return true;
-    }
-    return false;
+    return getPOIAt(worldPos) != nullptr;
 }
 
 void Map::markPOITiles()
 {
-    for (const auto& poi : m_pois)
+    // Only blocking POIs turn their collision tiles into walls
+    for (size_t i = 0; i < m_poiOccupancy.size(); ++i)
     {
-        if (!poi->isBlocking())
+        const POICell& cell = m_poiOccupancy[i];
+        if (!cell.collision || cell.poi == NO_POI || !m_pois[cell.poi]->isBlocking())
             continue;
 
-        const auto& collisionRects = poi->getCollisionRects();
+        m_tiles[i].setTerrainType(MapTile::TerrainType::POI_Collision);
+        m_tiles[i].setWalkable(false);
+    }
+
+    m_needsRebuild = true;
+}
 
-        for (const auto& rect : collisionRects)
-        {
-            // Get tile range covered by this collision rect
-            sf::Vector2i topLeft = worldToTile(sf::Vector2f(rect.position));
-            sf::Vector2i bottomRight = worldToTile(sf::Vector2f(
-                rect.position.x + rect.size.x,
-                rect.position.y + rect.size.y
-            ));
+// ========================================================================================================
+// POI OCCUPANCY
+// ========================================================================================================
+int Map::getPOIIndexAt(int x, int y) const
+{
+    if (!isValidTile(x, y) || m_poiOccupancy.empty())
+        return NO_POI;
+    return m_poiOccupancy[y * m_width + x].poi;
+}
+
+const PointOfInterest* Map::getPOIAt(const sf::Vector2f& worldPos) const
+{
+    if (worldPos.x < 0.f || worldPos.y < 0.f)
+        return nullptr;
 
-            // Clamp to valid tile range
-            topLeft.x = std::max(0, topLeft.x);
-            topLeft.y = std::max(0, topLeft.y);
-            bottomRight.x = std::min(m_width - 1, bottomRight.x);
-            bottomRight.y = std::min(m_height - 1, bottomRight.y);
+    const sf::Vector2i tile = worldToTile(worldPos);
+    const int index = getPOIIndexAt(tile.x, tile.y);
+    return index == NO_POI ? nullptr : m_pois[index].get();
+}
 
-            // Mark tiles covered by collision rects as POI
-            for (int y = topLeft.y; y <= bottomRight.y; ++y)
-            {
-                for (int x = topLeft.x; x <= bottomRight.x; ++x)
+bool Map::isPOICollisionTile(int x, int y) const
+{
+    if (!isValidTile(x, y) || m_poiOccupancy.empty())
+        return false;
+    return m_poiOccupancy[y * m_width + x].collision != 0;
+}
+
+void Map::rebuildPOIOccupancy()
+{
+    m_poiOccupancy.assign(m_tiles.size(), POICell());
+    for (size_t i = 0; i < m_pois.size(); ++i)
+        rasterizePOI(static_cast<int>(i));
+}
+
+void Map::rasterizePOI(int poiIndex)
+{
+    if (m_poiOccupancy.size() != m_tiles.size())
+        m_poiOccupancy.assign(m_tiles.size(), POICell());
+
+    const PointOfInterest& poi = *m_pois[poiIndex];
+
+    // Visits every tile the rect touches, clamped to the map
+    auto forTilesIn = [&](const sf::FloatRect& rect, auto&& visit)
+    {
+        sf::Vector2i topLeft = worldToTile(rect.position);
+        sf::Vector2i bottomRight = worldToTile(rect.position + rect.size);
+
+        topLeft.x = std::max(0, topLeft.x);
+        topLeft.y = std::max(0, topLeft.y);
+        bottomRight.x = std::min(m_width - 1, bottomRight.x);
+        bottomRight.y = std::min(m_height - 1, bottomRight.y);
+
+        for (int y = topLeft.y; y <= bottomRight.y; ++y)
+            for (int x = topLeft.x; x <= bottomRight.x; ++x)
+                visit(x, y);
+    };
+
+    // Sprite overhang 0, non-blocking collision 1, blocking collision 2. The cell's collision
+    // flag is always its owner's, so the owner's rank comes straight from the cell
+    auto rankOf = [&](bool collision, bool blocking) { return collision ? (blocking ? 2 : 1) : 0; };
+    const bool blocking = poi.isBlocking();
+
+    auto claim = [&](int x, int y, bool collision)
+    {
+        // Higher rank takes the tile so a wall under a walk-through POI still ends up a wall,
+        // on a tie the first POI in keeps it
+        POICell& cell = m_poiOccupancy[y * m_width + x];
+        if (cell.poi == NO_POI
+            || rankOf(collision, blocking) > rankOf(cell.collision != 0, m_pois[cell.poi]->isBlocking()))
+            cell.poi = static_cast<std::int16_t>(poiIndex);
+        if (collision)
+            cell.collision = 1;
+    };
+
+    // Whole sprite area first
+    forTilesIn(poi.getVisualBounds(), [&](int x, int y) { claim(x, y, false); });
+
+    // Collision shapes, polygons are tested per tile instead of filling their AABB
+    for (const auto& shape : poi.getCollisionShapes())
+    {
+        std::visit([&](const auto& s)
+        {
+                using T = std::decay_t<decltype(s)>;
+                if constexpr (std::is_same_v<T, sf::FloatRect>)
                 {
-                    MapTile* tile = getTile(x, y);
-                    tile->setTerrainType(MapTile::TerrainType::POI_Collision);
-                    tile->setWalkable(false);
+                    forTilesIn(s, [&](int x, int y) { claim(x, y, true); });
                 }
-            }
-        }
+                else if constexpr (std::is_same_v<T, CollisionPolygon>)
+                {
+                    forTilesIn(s.bounds, [&](int x, int y)
+                    {
+                            const sf::FloatRect tileRect(
+                                sf::Vector2f(x * m_tileSize, y * m_tileSize),
+                                sf::Vector2f(m_tileSize, m_tileSize));
+
+                            if (CollisionManager::aabbVsPolygon(tileRect, s.points))
+                                claim(x, y, true);
+                    });
+                }
+        }, shape);
     }
-
-    m_needsRebuild = true;
 }
 
 // ========================================================================================================
@@ -226,6 +306,7 @@ void Map::renderTerrain(sf::RenderTarget& target, const sf::View& view) const
 
             sf::IntRect texRect = getTerrainTextureRect(tile->getTerrainType());
             m_sharedSprite->setTextureRect(texRect);
+            m_sharedSprite->getSprite().setColor(getTerrainTint(tile->getTerrainType()));
 
             float worldX = x * m_tileSize;
             float worldY = y * m_tileSize;
@@ -327,56 +408,84 @@ void Map::renderDebug(sf::RenderTarget& target) const
 
 void Map::renderVoronoiBoundaries(sf::RenderTarget& target) const
 {
-    // Draw lines between tiles that belong to different Voronoi regions
-    sf::VertexArray boundaryLines(sf::PrimitiveType::Lines);
+    // Built by buildVoronoiBoundaries() when the regions were assigned, one draw call
+    if (m_boundaryLines.getVertexCount() > 0)
+        target.draw(m_boundaryLines);
+}
+
+void Map::buildVoronoiBoundaries()
+{
+    // clear() keeps the vertex storage, so a regeneration only appends into old capacity
+    m_boundaryLines.clear();
+    if (m_width <= 0 || m_height <= 0)
+        return;
+
+    // A border between two labelled tiles in different regions, unlabelled tiles never draw one
+    auto isBorder = [](const MapTile& a, const MapTile& b)
+    {
+        return a.getVoronoiRegion() != -1 && b.getVoronoiRegion() != -1
+            && a.getVoronoiRegion() != b.getVoronoiRegion();
+    };
+
+    auto addSegment = [this](const sf::Vector2f& from, const sf::Vector2f& to)
+    {
+        m_boundaryLines.append(sf::Vertex{ from, sf::Color::White, {} });
+        m_boundaryLines.append(sf::Vertex{ to, sf::Color::White, {} });
+    };
+
+    // Vertical edges run down a column, so each column keeps its open run while the rows go by
+    m_boundaryRunStart.assign(m_width, -1);
 
     for (int y = 0; y < m_height; ++y)
     {
+        const MapTile* row = &m_tiles[y * m_width];
+        const MapTile* rowBelow = (y + 1 < m_height) ? row + m_width : nullptr;
+
+        int horizontalStart = -1;
         for (int x = 0; x < m_width; ++x)
         {
-            const MapTile* tile = getTile(x, y);
-            if (!tile || tile->getVoronoiRegion() == -1)
-                continue;
-
-            int currentRegion = tile->getVoronoiRegion();
-
-            // Check right neighbor
-            if (x < m_width - 1)
+            // Horizontal edge under (x, y), extend the run or close it
+            const bool bottom = rowBelow && isBorder(row[x], rowBelow[x]);
+            if (bottom && horizontalStart < 0)
+                horizontalStart = x;
+            else if (!bottom && horizontalStart >= 0)
             {
-                const MapTile* rightTile = getTile(x + 1, y);
-                if (rightTile && rightTile->getVoronoiRegion() != currentRegion &&
-                    rightTile->getVoronoiRegion() != -1)
-                {
-                    // Draw vertical line on right edge
-                    float lineX = (x + 1) * m_tileSize;
-                    float lineY1 = y * m_tileSize;
-                    float lineY2 = (y + 1) * m_tileSize;
-
-                    boundaryLines.append(sf::Vertex({ sf::Vector2f(lineX, lineY1), sf::Color::White }));
-                    boundaryLines.append(sf::Vertex({ sf::Vector2f(lineX, lineY2), sf::Color::White }));
-                }
+                const float lineY = (y + 1) * m_tileSize;
+                addSegment(sf::Vector2f(horizontalStart * m_tileSize, lineY), sf::Vector2f(x * m_tileSize, lineY));
+                horizontalStart = -1;
             }
 
-            // Check bottom neighbor
-            if (y < m_height - 1)
+            // Vertical edge right of (x, y)
+            const bool right = x + 1 < m_width && isBorder(row[x], row[x + 1]);
+            int& verticalStart = m_boundaryRunStart[x];
+            if (right && verticalStart < 0)
+                verticalStart = y;
+            else if (!right && verticalStart >= 0)
             {
-                const MapTile* bottomTile = getTile(x, y + 1);
-                if (bottomTile && bottomTile->getVoronoiRegion() != currentRegion &&
-                    bottomTile->getVoronoiRegion() != -1)
-                {
-                    // Draw horizontal line on bottom edge
-                    float lineX1 = x * m_tileSize;
-                    float lineX2 = (x + 1) * m_tileSize;
-                    float lineY = (y + 1) * m_tileSize;
-
-                    boundaryLines.append(sf::Vertex({ sf::Vector2f(lineX1, lineY), sf::Color::White }));
-                    boundaryLines.append(sf::Vertex({ sf::Vector2f(lineX2, lineY), sf::Color::White }));
-                }
+                const float lineX = (x + 1) * m_tileSize;
+                addSegment(sf::Vector2f(lineX, verticalStart * m_tileSize), sf::Vector2f(lineX, y * m_tileSize));
+                verticalStart = -1;
             }
         }
+
+        if (horizontalStart >= 0)
+        {
+            const float lineY = (y + 1) * m_tileSize;
+            addSegment(sf::Vector2f(horizontalStart * m_tileSize, lineY), sf::Vector2f(m_width * m_tileSize, lineY));
+        }
     }
 
-    target.draw(boundaryLines);
+    // Runs still open at the bottom of the map
+    for (int x = 0; x < m_width; ++x)
+    {
+        if (m_boundaryRunStart[x] < 0)
+            continue;
+
+        const float lineX = (x + 1) * m_tileSize;
+        addSegment(sf::Vector2f(lineX, m_boundaryRunStart[x] * m_tileSize), sf::Vector2f(lineX, m_height * m_tileSize));
+    }
+
+    LOG_DEBUG(MapGen, "Voronoi boundaries: %zu merged segments", getVoronoiBoundarySegmentCount());
 }
 
 // ========================================================================================================
@@ -400,7 +509,7 @@ bool Map::loadTerrainAtlas(const std::string& atlasPath)
     }
 
     m_atlasLoaded = true;
-    std::cout << "Terrain atlas loaded: " << atlasPath << " (using shared sprite)\n";
+    LOG_DEBUG(MapGen, "Terrain atlas loaded: %s (using shared sprite)", atlasPath.c_str());
     return true;
 }
 
@@ -424,4 +533,19 @@ sf::IntRect Map::getTerrainTextureRect(MapTile::TerrainType type) const
     default:
         return sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(tilePixelSize, tilePixelSize));
     }
+}
+
+sf::Color Map::getTerrainTint(MapTile::TerrainType type)
+{
+    switch (type)
+    {
+    case MapTile::TerrainType::Dirt:
+        return sf::Color(190, 140, 90);
+    case MapTile::TerrainType::Water:
+        return sf::Color(90, 140, 255);
+    case MapTile::TerrainType::Stone:
+        return sf::Color(160, 160, 160);
+    default:
+        return sf::Color::White;
+    }
 }
\ No newline at end of file
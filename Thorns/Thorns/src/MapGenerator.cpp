@@ -1,164 +1,627 @@
 #include "MapGenerator.h"
 #include "PointOfInterest.h"
+#include "GenerationCache.h"
+#include "JobSystem.h"
+#include <array>
+#include <atomic>
 #include <iostream>
 #include <chrono>
+#include <mutex>
+#include <thread>
 #include "AssetPaths.h"
+#include "Logger.h"
+#include "Profiler.h"
 #include <numeric>
+#include <algorithm>
+
+// Phase chatter, dropped in quiet mode. Warnings and errors always go through
+#define GEN_LOG_INFO(...)                           \
+    do {                                            \
+        if (!m_quiet)                               \
+            LOG_INFO(MapGen, __VA_ARGS__);          \
+    } while (0)
+
+using GenClock = std::chrono::high_resolution_clock;
+
+static double millisecondsSince(GenClock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(GenClock::now() - start).count();
+}
 
 MapGenerator::MapGenerator()
     : m_voronoi(std::make_unique<VoronoiDiagram>())
     , m_objectPlacer(std::make_unique<ObjectPlacer>())
+    , m_shared(loadSharedData())
 {
-    m_poiTemplates.loadTemplate("hideout", Assets::Maps::HIDEOUT_TEMPLATE);
-    m_poiTemplates.loadTemplate("farm", Assets::Maps::FARM_TEMPLATE);
+    m_voronoi->setScratchResource(&m_arena);
+    m_objectPlacer->setScratchResource(&m_arena);
+}
+
+std::shared_ptr<const MapGenerator::SharedData> MapGenerator::loadSharedData()
+{
+    // Weak so it's freed with the last generator, the lock also keeps two threads from
+    // parsing (and writing the template cache files) at the same time
+    static std::mutex mutex;
+    static std::weak_ptr<const SharedData> loaded;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto existing = loaded.lock())
+        return existing;
+
+    auto data = std::make_shared<SharedData>();
+    data->poiTemplates.loadTemplate("hideout", Assets::Maps::HIDEOUT_TEMPLATE);
+    data->poiTemplates.loadTemplate("farm", Assets::Maps::FARM_TEMPLATE);
+
+    loaded = data;
+    return data;
 }
 
 std::unique_ptr<Map> MapGenerator::generate(const GenerationSettings& settings)
 {
-    // Step 2: Generate the base map (pn step 1 in game.cpp)
-    std::cout << "\n=== Starting Map Generation ===\n";
+    PROFILE_ZONE("MapGenerator::generate");
 
-    auto startTotal = std::chrono::high_resolution_clock::now();
+    // Step 2: Generate the base map (pn step 1 in game.cpp)
+    GEN_LOG_INFO("=== Starting Map Generation ===");
 
     // Step 2.1: All tiles are UNKNOWN initally and use the default params while also alocating memory for map
     auto map = std::make_unique<Map>();
     map->initialize(settings.mapWidth, settings.mapHeight, settings.tileSize);
 
     // Step 2.2: Load the terrain atlas (to be updated with new types)
-    if (!map->loadTerrainAtlas(Assets::Textures::TERRAIN_ATLAS)) {
+    if (m_headless)
+    {
+        map->setDebugMode(true);
+    }
+    else if (!map->loadTerrainAtlas(Assets::Textures::TERRAIN_ATLAS)) {
         std::cerr << "Failed to load the Map terrain atlas, defaulted to debug rendering\n";
         map->setDebugMode(true);
     }
 
+    // Known settings skip every phase
+    if (restoreFromCache(map.get(), settings))
+        return map;
+
+    // Seed 0 is resolved once here so every phase (and the report) sees the same seed
+    GenerationSettings resolved = settings;
+    if (resolved.seed == 0)
+        resolved.seed = std::random_device{}();
+
+    runPhases(map.get(), resolved);
+
+    GEN_LOG_INFO("=== Map Generation Complete ===");
+    GEN_LOG_INFO("mapGeneration took %.2f ms with a map size of %ux%u (seed %u)",
+        m_report.totalMs, static_cast<unsigned>(settings.mapHeight), static_cast<unsigned>(settings.mapWidth),
+        resolved.seed);
+
+    storeInCache(map.get(), settings);
+
+    return map;
+}
+
+void MapGenerator::regenerate(Map* map, const GenerationSettings& settings)
+{
+    PROFILE_ZONE("MapGenerator::regenerate");
+
+    if (!map)
+    {
+        std::cerr << "MapGenerator::regenerate() - null map pointer!\n";
+        return;
+    }
+
+    if (restoreFromCache(map, settings))
+        return;
+
+    GEN_LOG_INFO("=== Regenerating Existing Map ===");
+
+    // Reset map data (clears tiles and POIs, keeps memory allocated)
+    map->reset();
+
+    GenerationSettings resolved = settings;
+    if (resolved.seed == 0)
+        resolved.seed = std::random_device{}();
+
+    runPhases(map, resolved);
+
+    GEN_LOG_INFO("=== Map Regeneration Complete (seed %u, %.2f ms) ===", resolved.seed, m_report.totalMs);
+
+    storeInCache(map, settings);
+}
+
+void MapGenerator::runPhases(Map* map, const GenerationSettings& settings)
+{
+    const auto startTotal = GenClock::now();
+
+    // Last run's temporaries are all dead by now, one rewind frees them
+    m_arena.reset();
+
+    m_report = GenerationReport();
+    m_report.seed = settings.seed;
+
     // Setup static POIs (hideout at the center)
     // Step 2.3: Where the hideout needs to be based on map size
-    setupHideoutPOI(map.get());
+    setupHideoutPOI(map);
     map->markPOITiles();
-    
 
     // Run generation phases
     // ========== VORONOI DIAGRAMS ==========
     //Step 3: Seeds Voronoi
-    std::cout << "\n--- Phase 1: Voronoi Diagram ---\n";
-    phase1_Voronoi(map.get(), settings);
+    auto start = GenClock::now();
+    GEN_LOG_INFO("--- Phase 1: Voronoi Diagram ---");
+    phase1_Voronoi(map, settings);
 
     // Step 3.1: Spawn POIs at Voronoi sites
-    std::cout << "\n--- Spawning POIs at Voronoi sites ---\n";
-    spawnPOIsAtSites(map.get(), settings);
+    GEN_LOG_INFO("--- Spawning POIs at Voronoi sites ---");
+    spawnPOIsAtSites(map, settings);
     map->markPOITiles();
+    m_report.voronoiMs = millisecondsSince(start);
+
+    // ========== BIOMES ==========
+    // After the POIs so their footprints can be kept clear of water and stone, before the
+    // automata so thickets only grow on what's left as grass
+    start = GenClock::now();
+    if (settings.enableBiomes)
+    {
+        phase1b_Biomes(map, settings);
+    }
+    else
+    {
+        GEN_LOG_INFO("--- Phase 1b: Biomes (SKIPPED) ---");
+    }
+    m_report.biomeMs = millisecondsSince(start);
+
+    // ========== CELLULAR AUTOMATA ==========
+    // Runs ahead of object placement so trees and rocks never end up inside a thicket
+    start = GenClock::now();
+    if (settings.enableCellularAutomata)
+    {
+        phase3_CellularAutomata(map, settings);
+    }
+    else
+    {
+        GEN_LOG_INFO("--- Phase 3: Cellular Automata (SKIPPED) ---");
+    }
+    m_report.automataMs = millisecondsSince(start);
+
+    // ========== CONNECTIVITY ==========
+    // Also before objects, corridors are carved as forest which grass only placement skips
+    start = GenClock::now();
+    if (settings.enableConnectivityRepair)
+    {
+        phase4_Connectivity(map);
+    }
+    else
+    {
+        GEN_LOG_INFO("--- Phase 4: Connectivity Check (SKIPPED) ---");
+    }
+    m_report.connectivityMs = millisecondsSince(start);
 
     // ========== PERLIN NOISE ==========
-    std::cout << "\n--- Phase 2: Perlin Noise ---\n";
+    start = GenClock::now();
     if (settings.enableObjectPlacement)
     {
-        phase2_PerlinObjects(map.get(), settings);
+        phase2_PerlinObjects(map, settings);
     }
     else
     {
-        std::cout << "\n--- Phase 2: Perlin Noise (SKIPPED) ---\n";
+        m_objectPlacer->clearObjects();
+        GEN_LOG_INFO("--- Phase 2: Perlin Noise (SKIPPED) ---");
     }
+    m_report.objectsMs = millisecondsSince(start);
 
-    std::cout << "\n--- Phase 3: Cellular Automata ---\n";
+    m_report.siteCount = static_cast<int>(m_voronoi->getSites().size());
+    m_report.poiCount = static_cast<int>(map->getPOIs().size());
+    m_report.objectCount = m_objectPlacer->getObjectCount();
+    m_report.arenaBytes = m_arena.getBytesUsed();
+    m_report.totalMs = millisecondsSince(startTotal);
 
-    std::cout << "\n--- Phase 4: Connectivity Check ---\n";
+    if (m_arena.hasSpilled())
+    {
+        LOG_DEBUG(MapGen, "Generation arena spilled: %zu of %zu bytes, grows on the next run",
+            m_arena.getBytesUsed(), m_arena.getCapacity());
+    }
+}
 
-    std::cout << "\n=== Map Generation Complete ===\n\n";
+// ========================================================================================================
+// BATCH GENERATION
+// - Plain threads, one generator + map each, pulling the next seed off a shared index
+// - Not on the JobSystem: a seed takes far longer than any job, and wait() helping with queued
+//   work could start a second seed on a thread that's still inside the first
+// - The phases still use the JobSystem inside each seed, those jobs are independent chunks
+// ========================================================================================================
+std::vector<MapGenerator::GenerationReport> MapGenerator::generateBatch(const GenerationSettings& settings,
+    const std::vector<unsigned int>& seeds, unsigned int threadCount, const BatchCallback& onGenerated)
+{
+    PROFILE_ZONE("MapGenerator::generateBatch");
+
+    std::vector<GenerationReport> reports(seeds.size());
+    if (seeds.empty())
+        return reports;
 
-    auto endTotal = std::chrono::high_resolution_clock::now();
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, static_cast<unsigned int>(seeds.size()));
 
-    std::chrono::duration<double, std::milli> elapsed = endTotal - startTotal;
+    LOG_INFO(MapGen, "Batch generation: %zu seeds on %u threads", seeds.size(), threadCount);
+    const auto start = GenClock::now();
 
-    
-    std::cout <<"\n====GENERATION TIME===\n" << "mapGeneration took " << elapsed.count() << " ms\n"
-        << "With a map size of " << std::to_string(settings.mapHeight) << "x" << std::to_string(settings.mapWidth) << "\n";
+    std::atomic<size_t> nextSeed{ 0 };
+    auto worker = [&]()
+    {
+        MapGenerator generator;
+        generator.setQuiet(true);
+        generator.setHeadless(true);
 
+        Map map;
+        map.initialize(settings.mapWidth, settings.mapHeight, settings.tileSize);
+        map.setDebugMode(true);
 
-    return map;
+        GenerationSettings seedSettings = settings;
+        for (size_t i = nextSeed.fetch_add(1); i < seeds.size(); i = nextSeed.fetch_add(1))
+        {
+            seedSettings.seed = seeds[i];
+            generator.regenerate(&map, seedSettings);
+
+            // Each index is written by exactly one thread, join() publishes them
+            reports[i] = generator.getLastReport();
+
+            if (onGenerated)
+                onGenerated(generator, map, reports[i]);
+        }
+    };
+
+    // The calling thread takes a share too
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (unsigned int i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (auto& thread : threads)
+        thread.join();
+
+    LOG_INFO(MapGen, "Batch generation complete: %zu seeds in %.2f ms", seeds.size(), millisecondsSince(start));
+    return reports;
 }
 
-void MapGenerator::regenerate(Map* map, const GenerationSettings& settings)
+// ========================================================================================================
+// GENERATION CACHE
+// ========================================================================================================
+std::uint64_t MapGenerator::GenerationSettings::cacheKey() const
 {
-    if (!map)
+    // FNV-1a over each field's bytes, fields are hashed one by one so struct padding never leaks in
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    auto mix = [&hash](const auto& value)
     {
-        std::cerr << "MapGenerator::regenerate() - null map pointer!\n";
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+        for (size_t i = 0; i < sizeof(value); ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ull;
+        }
+    };
+
+    // Format and generator versions first, a layout or phase change invalidates every old entry
+    mix(MapSnapshot::FILE_VERSION);
+    mix(GENERATOR_VERSION);
+
+    mix(mapWidth);
+    mix(mapHeight);
+    mix(tileSize);
+
+    // Variant index first so ManualSites{3} and AutoDensity{Dense} can't collide
+    mix(siteMode.index());
+    if (const auto* manual = std::get_if<ManualSites>(&siteMode))
+        mix(manual->count);
+    else if (const auto* automatic = std::get_if<AutoDensity>(&siteMode))
+        mix(automatic->density);
+
+    mix(minSiteDistance);
+    mix(seed);
+    mix(lloydIterations);
+    mix(numVillages);
+    mix(numFarms);
+
+    mix(enableBiomes);
+    mix(biomeFrequency);
+
+    mix(enableObjectPlacement);
+    mix(objectFrequency);
+    mix(objectOctaves);
+    mix(objectThreshold);
+
+    mix(enableCellularAutomata);
+    mix(caFillChance);
+    mix(caIterations);
+    mix(caBirthMask);
+    mix(caSurvivalMask);
+
+    mix(enableConnectivityRepair);
+
+    return hash;
+}
+
+bool MapGenerator::restoreFromCache(Map* map, const GenerationSettings& settings)
+{
+    // Seed 0 means a fresh random map every time, nothing to reuse
+    if (!m_cache || settings.seed == 0)
+        return false;
+
+    PROFILE_ZONE("MapGenerator::restoreFromCache");
+
+    MapSnapshot snapshot;
+    if (!m_cache->find(settings.cacheKey(), snapshot))
+        return false;
+
+    const auto start = GenClock::now();
+    if (!restore(map, snapshot))
+        return false;
+
+    m_report = GenerationReport();
+    m_report.seed = settings.seed;
+    m_report.fromCache = true;
+    m_report.siteCount = static_cast<int>(m_voronoi->getSites().size());
+    m_report.poiCount = static_cast<int>(map->getPOIs().size());
+    m_report.objectCount = m_objectPlacer->getObjectCount();
+    m_report.totalMs = millisecondsSince(start);
+
+    GEN_LOG_INFO("=== Map restored from generation cache (seed %u) ===", settings.seed);
+    return true;
+}
+
+void MapGenerator::storeInCache(const Map* map, const GenerationSettings& settings)
+{
+    if (!m_cache || settings.seed == 0)
         return;
-    }
 
-    std::cout << "\n=== Regenerating Existing Map ===\n";
+    PROFILE_ZONE("MapGenerator::storeInCache");
 
-    // Reset map data (clears tiles and POIs, keeps memory allocated)
-    map->reset();
+    // Spawns use the same defaults as the getters, restored maps rebuild them from the sites anyway
+    std::vector<sf::Vector2f> enemySpawns;
+    std::vector<sf::Vector2f> itemSpawns;
+    getEnemySpawnPoints(map, enemySpawns);
+    getItemSpawnPoints(map, itemSpawns);
 
-    // Setup static POIs (hideout at the center)
-    setupHideoutPOI(map);
-    map->markPOITiles();
+    std::vector<std::uint8_t> bytes;
+    buildSnapshot(map, settings.seed, enemySpawns, itemSpawns, bytes);
+    m_cache->store(settings.cacheKey(), std::move(bytes));
+}
 
-    // Run generation phases
-    // ========== VORONOI DIAGRAMS ==========
-    std::cout << "\n--- Phase 1: Voronoi Diagram ---\n";
-    phase1_Voronoi(map, settings);
 
-    // Spawn POIs at Voronoi sites
-    std::cout << "\n--- Spawning POIs at Voronoi sites ---\n";
-    spawnPOIsAtSites(map, settings);
-    map->markPOITiles();
+// ========================================================================================================
+// SNAPSHOTS
+// - Restore skips every generation phase, the file already holds their output
+// ========================================================================================================
+std::unique_ptr<Map> MapGenerator::load(const MapSnapshot& snapshot)
+{
+    PROFILE_ZONE("MapGenerator::load");
 
-    // ========== PERLIN NOISE ==========
-    std::cout << "\n--- Phase 2: Perlin Noise ---\n";
-    if (settings.enableObjectPlacement)
+    if (!snapshot.isValid())
     {
-        phase2_PerlinObjects(map, settings);
+        std::cerr << "MapGenerator::load() - snapshot not loaded\n";
+        return nullptr;
     }
 
-    std::cout << "\n--- Phase 3: Cellular Automata ---\n";
+    auto map = std::make_unique<Map>();
+
+    if (!map->loadTerrainAtlas(Assets::Textures::TERRAIN_ATLAS)) {
+        std::cerr << "Failed to load the Map terrain atlas, defaulted to debug rendering\n";
+        map->setDebugMode(true);
+    }
 
-    std::cout << "\n--- Phase 4: Connectivity Check ---\n";
+    if (!restore(map.get(), snapshot))
+        return nullptr;
 
-    std::cout << "\n=== Map Regeneration Complete ===\n\n";
+    return map;
 }
 
-
-std::vector<sf::Vector2f> MapGenerator::getEnemySpawnPoints(int countPerPOI, float spawnRadius) const
+bool MapGenerator::restore(Map* map, const MapSnapshot& snapshot)
 {
-    std::vector<sf::Vector2f> points;
+    PROFILE_ZONE("MapGenerator::restore");
 
-    const auto& sites = m_voronoi->getSites();
-    if (sites.empty()) return points;
+    if (!map || !snapshot.isValid())
+    {
+        std::cerr << "MapGenerator::restore() - null map or snapshot not loaded\n";
+        return false;
+    }
 
+    auto start = std::chrono::high_resolution_clock::now();
 
-    // Offset insurance
-    const sf::Vector2f offsets[] = {
-        { spawnRadius,  0.f },
-        { -spawnRadius, 0.f },
-        { 0.f,  spawnRadius },
-        { 0.f, -spawnRadius }
-    };
+    const MapSnapshot::Header& header = snapshot.getHeader();
+    GEN_LOG_INFO("=== Restoring Map From Snapshot (seed %u, %ux%u) ===",
+        header.seed, static_cast<unsigned>(header.width), static_cast<unsigned>(header.height));
+
+    // Step 1: Check every enum up front so a bad file can't leave a half built map behind
+    const auto terrain = snapshot.getTerrain();
+    for (std::uint8_t type : terrain)
+    {
+        if (type > static_cast<std::uint8_t>(MapTile::TerrainType::POI_Collision))
+        {
+            std::cerr << "MapGenerator::restore() - snapshot has an unknown terrain type\n";
+            return false;
+        }
+    }
 
-    int offsetCount = std::min(countPerPOI, 4);
+    for (const MapSnapshot::POIRecord& record : snapshot.getPOIs())
+    {
+        if (record.type >= static_cast<std::uint8_t>(PointOfInterest::Type::COUNT))
+        {
+            std::cerr << "MapGenerator::restore() - snapshot has an unknown POI type\n";
+            return false;
+        }
+    }
 
-    // PN: Skip 0 due to site being near hideout
-    for (size_t i = 1; i < sites.size(); ++i)
+    for (const MapSnapshot::ObjectRecord& record : snapshot.getObjects())
     {
-        for (int j = 0; j < offsetCount; ++j)
-            points.push_back(sites[i].position + offsets[j]);
+        if (record.type >= static_cast<std::uint8_t>(WorldObject::Type::COUNT))
+        {
+            std::cerr << "MapGenerator::restore() - snapshot has an unknown object type\n";
+            return false;
+        }
     }
 
-    return points;
+    // Step 2: Tiles, reuse the allocation when the size matches
+    map->reset();
+    if (map->getWidth() != header.width || map->getHeight() != header.height || map->getTileSize() != header.tileSize)
+        map->initialize(header.width, header.height, header.tileSize);
+
+    const auto walkable = snapshot.getWalkable();
+    const auto regions = snapshot.getRegions();
+    const int width = header.width;
+
+    for (size_t i = 0; i < terrain.size(); ++i)
+    {
+        MapTile* tile = map->getTile(static_cast<int>(i % width), static_cast<int>(i / width));
+        tile->setTerrainType(static_cast<MapTile::TerrainType>(terrain[i]));
+        tile->setWalkable(walkable[i] != 0);
+        tile->setVoronoiRegion(regions[i]);
+    }
+
+    // Step 3: POIs, collision tiles are already in the terrain so markPOITiles isn't needed
+    for (const MapSnapshot::POIRecord& record : snapshot.getPOIs())
+    {
+        const auto type = static_cast<PointOfInterest::Type>(record.type);
+        if (type == PointOfInterest::Type::PlayerHideout)
+        {
+            setupHideoutPOI(map);
+            continue;
+        }
+
+        auto poi = createPOI(type, sf::Vector2f(record.x, record.y), record.instance);
+        if (poi)
+            map->addPOI(std::move(poi));
+    }
+
+    // Step 4: Voronoi sites, spatial grid cell size matches what phase 1 derives for this count
+    std::vector<VoronoiSite> sites;
+    sites.reserve(snapshot.getSites().size());
+    for (const MapSnapshot::SiteRecord& record : snapshot.getSites())
+    {
+        VoronoiSite site(sf::Vector2f(record.x, record.y), sf::Vector2i(record.tileX, record.tileY), record.regionId);
+        site.debugColor = sf::Color(record.r, record.g, record.b);
+        site.hasPOI = record.hasPOI != 0;
+        sites.push_back(site);
+    }
+
+    GenerationSettings layout;
+    layout.mapWidth = header.width;
+    layout.mapHeight = header.height;
+    layout.tileSize = header.tileSize;
+    const sf::Vector2f worldSize = map->getWorldSize();
+    const int siteCount = static_cast<int>(sites.size());
+    m_voronoi->restoreSites(std::move(sites), worldSize.x, worldSize.y, layout.deriveMinSiteDistance(siteCount));
+
+    // Region ids came with the tiles, the table is rebuilt from them
+    m_regionGraph.build(*map, siteCount);
+    if (!m_headless)
+    {
+        map->buildVoronoiBoundaries();
+        m_voronoi->buildDebugGeometry();
+    }
+
+    // Step 5: World objects
+    m_objectPlacer->clearObjects();
+    if (!snapshot.getObjects().empty() && ensureObjectAssets())
+    {
+        m_objectPlacer->reserveObjects(snapshot.getObjects().size());
+        for (const MapSnapshot::ObjectRecord& record : snapshot.getObjects())
+            m_objectPlacer->placeObject(static_cast<WorldObject::Type>(record.type), sf::Vector2f(record.x, record.y));
+    }
+
+    // Step 6: Corridors are already carved, only the labels and distance field need rebuilding
+    for (const auto& poi : map->getPOIs())
+    {
+        if (poi->getType() != PointOfInterest::Type::PlayerHideout)
+            continue;
+
+        m_connectivity.labelComponents(*map);
+        m_connectivity.buildDistanceField(*map, getPOIEntranceTile(map, *poi));
+        break;
+    }
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+    GEN_LOG_INFO("Snapshot restore complete: %zu POIs, %d sites, %d objects (%.2f ms)",
+        map->getPOIs().size(), siteCount, m_objectPlacer->getObjectCount(), elapsed.count());
+
+    return true;
+}
+
+void MapGenerator::buildSnapshot(const Map* map, unsigned int seed,
+    const std::vector<sf::Vector2f>& enemySpawns,
+    const std::vector<sf::Vector2f>& itemSpawns,
+    std::vector<std::uint8_t>& out) const
+{
+    MapSnapshot::Contents contents;
+    contents.map = map;
+    contents.sites = &m_voronoi->getSites();
+    contents.objects = &m_objectPlacer->getObjects();
+    contents.enemySpawns = &enemySpawns;
+    contents.itemSpawns = &itemSpawns;
+    contents.seed = seed;
+
+    MapSnapshot::build(contents, out);
+}
+
+void MapGenerator::getEnemySpawnPoints(const Map* map, std::vector<sf::Vector2f>& out,
+    int countPerPOI, float spawnRadius)
+{
+    out.clear();
+    sampleSpawnPoints(map, countPerPOI, spawnRadius, 48.f, 0x9e3779b9u, out);
+}
+
+void MapGenerator::getItemSpawnPoints(const Map* map, std::vector<sf::Vector2f>& out, float spawnRadius)
+{
+    out.clear();
+    sampleSpawnPoints(map, 1, spawnRadius, 32.f, 0x85ebca6bu, out);
 }
 
-std::vector<sf::Vector2f> MapGenerator::getItemSpawnPoints(float spawnRadius) const
+void MapGenerator::sampleSpawnPoints(const Map* map, int countPerSite, float spawnRadius, float spacing,
+    std::uint32_t salt, std::vector<sf::Vector2f>& out)
 {
-    std::vector<sf::Vector2f> points;
+    PROFILE_ZONE("MapGenerator::sampleSpawnPoints");
 
     const auto& sites = m_voronoi->getSites();
-    if (sites.empty()) return points;
+    if (!map || sites.empty() || countPerSite <= 0)
+        return;
+
+    const sf::FloatRect world(sf::Vector2f(0.f, 0.f), map->getWorldSize());
+
+    m_spawnSampler.clearExclusions();
+
+    PoissonSampler::Params params;
+    params.minRadius = std::min(spacing, spawnRadius);
+    params.maxRadius = params.minRadius;
+    params.maxPoints = static_cast<size_t>(countPerSite);
 
+    // PN: Skip 0 due to site being near hideout
     for (size_t i = 1; i < sites.size(); ++i)
     {
-        points.push_back(sites[i].position + sf::Vector2f(spawnRadius * 0.7f, spawnRadius * 0.7f));
-    }
+        const sf::Vector2f centre = sites[i].position;
 
-    return points;
+        const sf::FloatRect area(centre - sf::Vector2f(spawnRadius, spawnRadius),
+            sf::Vector2f(spawnRadius * 2.f, spawnRadius * 2.f));
+        const auto clipped = area.findIntersection(world);
+        if (!clipped)
+            continue;
+        params.bounds = *clipped;
+
+        auto accept = [&](const sf::Vector2f& pos)
+        {
+            const sf::Vector2f d = pos - centre;
+            if (d.x * d.x + d.y * d.y > spawnRadius * spawnRadius)
+                return false;
+
+            // Nothing spawns inside a POI footprint
+            const MapTile* tile = map->getTileAtWorldPos(pos);
+            return tile && tile->isWalkable() && !map->isInsidePOI(pos);
+        };
+
+        std::mt19937 rng(salt ^ (static_cast<std::uint32_t>(sites[i].tileCoords.x) * 73856093u)
+            ^ (static_cast<std::uint32_t>(sites[i].tileCoords.y) * 19349663u));
+
+        m_spawnSampler.sample(params, rng, m_spawnSamples, nullptr, accept);
+        out.insert(out.end(), m_spawnSamples.begin(), m_spawnSamples.end());
+    }
 }
 
 // ========================================================================================================
@@ -168,6 +631,8 @@ std::vector<sf::Vector2f> MapGenerator::getItemSpawnPoints(float spawnRadius) co
 // ========================================================================================================
 void MapGenerator::phase1_Voronoi(Map* map, const GenerationSettings& settings)
 {
+    PROFILE_ZONE("MapGenerator::phase1_Voronoi");
+
     // Step 1: Resolve site count and effective spacing from whichever mode is active.
     unsigned char siteCount = 0;
     float effectiveMinDist = 0.f;
@@ -183,14 +648,14 @@ void MapGenerator::phase1_Voronoi(Map* map, const GenerationSettings& settings)
                 // Manual mode: use explicit count, derive spacing from it
                 siteCount = mode.count;
                 effectiveMinDist = settings.deriveMinSiteDistance(siteCount);
-                std::cout << "Site mode: Manual (" << static_cast<int>(siteCount) << " sites)\n";
+                LOG_DEBUG(MapGen, "Site mode: Manual (%d sites)", static_cast<int>(siteCount));
             }
             else if constexpr (std::is_same_v<T, GenerationSettings::AutoDensity>)
             {
                 // Auto mode: count AND spacing both derived from density + map area
                 siteCount = calSiteOptimalCount(mode.density, settings);
                 effectiveMinDist = settings.deriveMinSiteDistance(siteCount);
-                std::cout << "Site mode: Auto density (" << static_cast<int>(siteCount) << " sites)\n";
+                LOG_DEBUG(MapGen, "Site mode: Auto density (%d sites)", static_cast<int>(siteCount));
             }
     }, settings.siteMode);
 
@@ -198,17 +663,17 @@ void MapGenerator::phase1_Voronoi(Map* map, const GenerationSettings& settings)
     if (settings.minSiteDistance > 0.f)
     {
         effectiveMinDist = settings.minSiteDistance;
-        std::cout << "minSiteDistance: " << effectiveMinDist << "px (manual override)\n";
+        LOG_DEBUG(MapGen, "minSiteDistance: %.1fpx (manual override)", effectiveMinDist);
     }
     else
     {
-        std::cout << "minSiteDistance: " << effectiveMinDist << "px (auto derived from site count)\n";
+        LOG_DEBUG(MapGen, "minSiteDistance: %.1fpx (auto derived from site count)", effectiveMinDist);
     }
 
-    std::cout << "Generating Voronoi diagram with " << static_cast<int>(siteCount) << " sites\n";
+    GEN_LOG_INFO("Generating Voronoi diagram with %d sites", static_cast<int>(siteCount));
 
     // Step 2: Generate Voronoi sites using Poisson disk sampling
-    std::mt19937 rng(settings.seed == 0 ? std::random_device{}() : settings.seed);
+    std::mt19937 rng(settings.seed);   // Resolved before the phases run, never 0 here
     sf::Vector2f worldSize = map->getWorldSize();
 
     m_voronoi->generateSitesPoisson(map, siteCount, m_hideoutPosition,
@@ -217,7 +682,7 @@ void MapGenerator::phase1_Voronoi(Map* map, const GenerationSettings& settings)
     // Step 3: Build spatial grid for fast nearest-neighbor queries.
     // Cell size must match effectiveMinDist so the 3x3 neighbourhood covers the full exclusion radius.
     const auto& sites = m_voronoi->getSites();
-    std::cout << "Building spatial grid for " << sites.size() << " sites...\n";
+    LOG_DEBUG(MapGen, "Building spatial grid for %zu sites...", sites.size());
 
     m_voronoi->buildSpatialGrid(worldSize.x, worldSize.y, effectiveMinDist);
 
@@ -229,72 +694,423 @@ void MapGenerator::phase1_Voronoi(Map* map, const GenerationSettings& settings)
 
     // Step 4: Single loop assign regions AND set terrain together
     // ========== Single Loop: Do everything in one pass (try to reduce n-notation hopefully) ==========
+    // Row bands run as jobs, every tile only reads the sites and writes itself
     int width = map->getWidth();
     int height = map->getHeight();
-    int tilesProcessed = 0;
+    std::atomic<int> tilesProcessed{ 0 };
+
+    // Bands start on multiples of at least VORONOI_ROWS_PER_JOB, so that's enough slots for any split
+    const int bandSlots = (height + VORONOI_ROWS_PER_JOB - 1) / VORONOI_ROWS_PER_JOB;
+    const int siteTotal = static_cast<int>(sites.size());
+    const int lloydIterations = settings.lloydIterations;
+    m_regionGraph.begin(siteTotal, bandSlots);
+
+    // Lloyd state, only allocated when relaxation is on. Per tile: distance to the runner up
+    // site minus distance to its own, how far the sites can move before the label might change
+    std::pmr::vector<float> borderGap(&m_arena);
+    std::pmr::vector<RegionSums> bandSums(&m_arena);
+    std::pmr::vector<float> displacement(&m_arena);
+    float maxDisplacement = 0.f;
+    if (lloydIterations > 0)
+    {
+        borderGap.assign(static_cast<size_t>(width) * height, 0.f);
+        bandSums.assign(static_cast<size_t>(bandSlots) * siteTotal, RegionSums());
+    }
 
-    for (int y = 0; y < height; ++y)
+    // Closest site among the grid neighbours. gap (Lloyd only, null skips it) is how much closer
+    // it is than any other site, the 3x3 cells only hold every site within one cell size, so the
+    // runner up is capped there. Sites outside the window can be that close and the window changes
+    // when relaxSites rebuilds the grid
+    const float gridCellSize = effectiveMinDist;
+    auto findClosest = [&](const sf::Vector2f& tilePos, std::pmr::vector<int>& nearbySites, float* gap)
     {
-        for (int x = 0; x < width; ++x)
+        // Find nearest Voronoi site using spatial grid (O(k) instead of O(n))
+        m_voronoi->getNearbySites(tilePos, nearbySites);
+
+        int closestRegion = -1;
+        float closestDistSq = std::numeric_limits<float>::max();
+        float secondDistSq = std::numeric_limits<float>::max();
+
+        // Check only nearby sites (spatial optimization)
+        for (int siteIdx : nearbySites)
         {
-            MapTile* tile = map->getTile(x, y);
-            if (!tile)
-                continue;
+            const VoronoiSite& site = sites[siteIdx];
+            float dx = tilePos.x - site.position.x;
+            float dy = tilePos.y - site.position.y;
+            float distSq = dx * dx + dy * dy;
 
-            // Skip POI tiles (hideout area)
-            if (tile->getTerrainType() == MapTile::TerrainType::POI_Collision)
-                continue;
+            if (distSq < closestDistSq)
+            {
+                secondDistSq = closestDistSq;
+                closestDistSq = distSq;
+                closestRegion = site.regionId;
+            }
+            else if (distSq < secondDistSq)
+            {
+                secondDistSq = distSq;
+            }
+        }
+
+        // A closest site past the cell size may not be the true closest, 0 has it checked every pass
+        if (gap)
+        {
+            const float runnerUp = std::min(std::sqrt(secondDistSq), gridCellSize);
+            *gap = std::max(0.f, runnerUp - std::sqrt(closestDistSq));
+        }
+        return closestRegion;
+    };
+
+    // fullPass labels every tile and sets its terrain. Otherwise it's a Lloyd relabel, only tiles
+    // whose gap is smaller than the sites could have moved get looked at. A skipped tile's site
+    // stays the closest and within a cell size of it, so the rebuilt grid would still find it and
+    // the result matches a full relabel.
+    // scanRegions feeds the region graph, done on whichever pass leaves the final labels
+    std::atomic<int> tilesChecked{ 0 };
+    std::atomic<int> tilesRelabelled{ 0 };
+    auto labelTiles = [&](bool fullPass, bool scanRegions)
+    {
+        JobSystem::parallelFor(0, height, VORONOI_ROWS_PER_JOB, [&](int rowBegin, int rowEnd)
+        {
+                // Bands run on other threads so they can't share the arena, each gets a stack buffer
+                // that covers the lookups. Overflow falls back to the heap rather than failing
+                alignas(int) std::array<std::byte, NEARBY_SCRATCH_SITES * sizeof(int)> scratchBytes;
+                std::pmr::monotonic_buffer_resource scratch(scratchBytes.data(), scratchBytes.size());
+                std::pmr::vector<int> nearbySites(&scratch);
+                nearbySites.reserve(NEARBY_SCRATCH_SITES);
+
+                const int bandIndex = rowBegin / VORONOI_ROWS_PER_JOB;
+                RegionSums* sums = bandSums.empty() ? nullptr : &bandSums[static_cast<size_t>(bandIndex) * siteTotal];
+
+                int bandTiles = 0;
+                int bandChecked = 0;
+                int bandRelabelled = 0;
+                for (int y = rowBegin; y < rowEnd; ++y)
+                {
+                    for (int x = 0; x < width; ++x)
+                    {
+                        MapTile* tile = map->getTile(x, y);
+                        if (!tile)
+                            continue;
+
+                        // Skip POI tiles (hideout area)
+                        if (tile->getTerrainType() == MapTile::TerrainType::POI_Collision)
+                            continue;
+
+                        const size_t index = static_cast<size_t>(y) * width + x;
+                        const int current = tile->getVoronoiRegion();
+
+                        // Own site moved by at most displacement[current], any rival by at most
+                        // the max, so a gap bigger than both together still holds
+                        if (!fullPass)
+                        {
+                            const float bound = (current >= 0 ? displacement[current] : 0.f) + maxDisplacement;
+                            if (current >= 0 && borderGap[index] > bound)
+                            {
+                                borderGap[index] -= bound;
+                                continue;
+                            }
+                            ++bandChecked;
+                        }
+
+                        const int closestRegion = findClosest(map->tileToWorld(x, y), nearbySites,
+                            borderGap.empty() ? nullptr : &borderGap[index]);
+
+                        if (fullPass)
+                        {
+                            tile->setVoronoiRegion(closestRegion);
+                            tile->setTerrainType(MapTile::TerrainType::Grass);
+                            tile->setWalkable(true);
+                            ++bandTiles;
+
+                            if (sums && closestRegion >= 0)
+                            {
+                                sums[closestRegion].sumX += x;
+                                sums[closestRegion].sumY += y;
+                                ++sums[closestRegion].tileCount;
+                            }
+                        }
+                        else if (closestRegion != current)
+                        {
+                            // Moves the tile between the band's running totals
+                            if (current >= 0)
+                            {
+                                sums[current].sumX -= x;
+                                sums[current].sumY -= y;
+                                --sums[current].tileCount;
+                            }
+                            if (closestRegion >= 0)
+                            {
+                                sums[closestRegion].sumX += x;
+                                sums[closestRegion].sumY += y;
+                                ++sums[closestRegion].tileCount;
+                            }
+
+                            tile->setVoronoiRegion(closestRegion);
+                            ++bandRelabelled;
+                        }
+                    }
+                }
+                tilesProcessed.fetch_add(bandTiles, std::memory_order_relaxed);
+                tilesChecked.fetch_add(bandChecked, std::memory_order_relaxed);
+                tilesRelabelled.fetch_add(bandRelabelled, std::memory_order_relaxed);
+
+                // Rows are still hot, the region stats and edges come out of the same band
+                if (scanRegions)
+                    m_regionGraph.scanBand(*map, bandIndex, rowBegin, rowEnd);
+        });
+    };
 
-            sf::Vector2f tilePos = map->tileToWorld(x, y);
+    labelTiles(true, lloydIterations == 0);
 
-            // Find nearest Voronoi site using spatial grid (O(k) instead of O(n))
-            std::vector<int> nearbySites = m_voronoi->getNearbySites(tilePos);
+    // Step 5: Lloyd relaxation, sites to their region centroids then relabel what could change
+    if (lloydIterations > 0)
+    {
+        PROFILE_ZONE("MapGenerator::lloydRelaxation");
 
-            int closestRegion = -1;
-            float closestDistSq = std::numeric_limits<float>::max();
+        const float tileSize = map->getTileSize();
+        std::pmr::vector<sf::Vector2f> centroids(sites.size(), &m_arena);
 
-            // Check only nearby sites (spatial optimization)
-            for (int siteIdx : nearbySites)
+        for (int iteration = 0; iteration < lloydIterations; ++iteration)
+        {
+            // Centroids, the band totals summed per region
+            for (int region = 0; region < siteTotal; ++region)
             {
-                const VoronoiSite& site = sites[siteIdx];
-                float dx = tilePos.x - site.position.x;
-                float dy = tilePos.y - site.position.y;
-                float distSq = dx * dx + dy * dy;
+                RegionSums total;
+                for (int band = 0; band < bandSlots; ++band)
+                {
+                    const RegionSums& sums = bandSums[static_cast<size_t>(band) * siteTotal + region];
+                    total.sumX += sums.sumX;
+                    total.sumY += sums.sumY;
+                    total.tileCount += sums.tileCount;
+                }
 
-                if (distSq < closestDistSq)
+                // Empty region (site boxed in by POIs) keeps its site where it is
+                if (total.tileCount == 0)
                 {
-                    closestDistSq = distSq;
-                    closestRegion = site.regionId;
+                    centroids[region] = sites[region].position;
+                    continue;
                 }
+
+                const double count = static_cast<double>(total.tileCount);
+                centroids[region] = sf::Vector2f(
+                    static_cast<float>((total.sumX / count + 0.5) * tileSize),
+                    static_cast<float>((total.sumY / count + 0.5) * tileSize));
             }
 
-            tile->setVoronoiRegion(closestRegion);
-            tile->setTerrainType(MapTile::TerrainType::Grass);
-            tile->setWalkable(true);
+            maxDisplacement = m_voronoi->relaxSites(*map, centroids, m_hideoutPosition, effectiveMinDist, displacement);
 
-            ++tilesProcessed;
+            // Nothing moved means nothing to relabel, the last pass still has to feed the region graph
+            const bool converged = maxDisplacement <= 0.f;
+            const bool lastPass = converged || iteration + 1 == lloydIterations;
+
+            tilesChecked.store(0, std::memory_order_relaxed);
+            tilesRelabelled.store(0, std::memory_order_relaxed);
+            labelTiles(false, lastPass);
+            ++m_report.relaxIterations;
+
+            LOG_DEBUG(MapGen, "Lloyd pass %d: max site move %.1fpx, %d tiles rechecked, %d relabelled",
+                iteration + 1, maxDisplacement, tilesChecked.load(), tilesRelabelled.load());
+
+            if (lastPass)
+                break;
         }
     }
 
-    std::cout << "Voronoi assignment complete: " << tilesProcessed << " tiles processed\n";
+    // Band seams + merge into the region table
+    m_regionGraph.finish(*map);
 
-    // Debug: Count tiles per region
-    std::unordered_map<int, int> regionCounts;
-    for (int y = 0; y < height; ++y)
+    // Debug overlay geometry, built once here so drawing it later is just the draw call
+    if (!m_headless)
+    {
+        map->buildVoronoiBoundaries();
+        m_voronoi->buildDebugGeometry();
+    }
+
+    GEN_LOG_INFO("Voronoi assignment complete: %d tiles processed", tilesProcessed.load());
+
+    // Debug: Tiles per region, straight from the table now instead of another map sweep
+    if (!LOG_ENABLED(Debug, MapGen))
+        return;
+
+    LOG_DEBUG(MapGen, "Tiles per region:");
+    for (int regionId = 0; regionId < m_regionGraph.getRegionCount(); ++regionId)
+    {
+        const RegionGraph::RegionInfo* info = m_regionGraph.getRegion(regionId);
+        LOG_DEBUG(MapGen, "  Region %d: %d tiles, %zu border tiles, %zu neighbours", regionId, info->tileCount,
+            m_regionGraph.getBorderTiles(regionId).size(), m_regionGraph.getNeighbours(regionId).size());
+    }
+}
+
+// ========================================================================================================
+// PHASE 1B: BIOMES
+// - Two noise fields (elevation, moisture), each region shifts them by its biome
+// - Both fields and the classification run per row band, a table lookup picks the terrain
+// ========================================================================================================
+namespace
+{
+    // How a biome shifts the two fields, so a Wetland region is lower and wetter than its noise says
+    struct BiomeBias
+    {
+        float elevation;
+        float moisture;
+    };
+
+    constexpr BiomeBias BIOME_BIASES[] =
+    {
+        {  0.00f,  0.00f },     // Meadow
+        {  0.05f,  0.12f },     // Woodland
+        { -0.12f,  0.12f },     // Wetland
+        {  0.12f, -0.08f },     // Highland
+        {  0.00f, -0.12f },     // Scrub
+    };
+    constexpr int BIOME_COUNT = static_cast<int>(sizeof(BIOME_BIASES) / sizeof(BIOME_BIASES[0]));
+
+    // Band edges for the fields, tuned so roughly half the map stays grass
+    constexpr float ELEVATION_LOW = 0.35f;
+    constexpr float ELEVATION_HIGH = 0.66f;
+    constexpr float MOISTURE_DRY = 0.40f;
+    constexpr float MOISTURE_WET = 0.64f;
+
+    using Terrain = MapTile::TerrainType;
+
+    // [clearing][elevation band][moisture band]. Clearings (around POIs and sites) swap water
+    // and stone for walkable ground so nothing spawns in a lake
+    constexpr Terrain BIOME_TERRAIN[2][3][3] =
     {
-        for (int x = 0; x < width; ++x)
         {
-            const MapTile* tile = map->getTile(x, y);
-            if (tile && tile->getVoronoiRegion() != -1)
-                regionCounts[tile->getVoronoiRegion()]++;
-        }
+            { Terrain::Dirt,  Terrain::Grass,  Terrain::Water },     // Low
+            { Terrain::Grass, Terrain::Grass,  Terrain::Forest },    // Mid
+            { Terrain::Stone, Terrain::Forest, Terrain::Forest },    // High
+        },
+        {
+            { Terrain::Dirt,  Terrain::Grass,  Terrain::Grass },
+            { Terrain::Grass, Terrain::Grass,  Terrain::Forest },
+            { Terrain::Dirt,  Terrain::Forest, Terrain::Forest },
+        },
+    };
+
+    constexpr bool isWalkableTerrain(Terrain terrain)
+    {
+        return terrain != Terrain::Water && terrain != Terrain::Stone;
+    }
+
+    // Which biome a region gets, hashed from the seed so it doesn't use up the phase rng
+    int biomeForRegion(unsigned int seed, int regionId)
+    {
+        std::uint32_t hash = seed ^ (static_cast<std::uint32_t>(regionId) * 0x9E3779B9u);
+        hash ^= hash >> 16;
+        hash *= 0x7feb352du;
+        hash ^= hash >> 15;
+        hash *= 0x846ca68bu;
+        hash ^= hash >> 16;
+        return static_cast<int>(hash % BIOME_COUNT);
+    }
+}
+
+void MapGenerator::phase1b_Biomes(Map* map, const GenerationSettings& settings)
+{
+    PROFILE_ZONE("MapGenerator::phase1b_Biomes");
+
+    GEN_LOG_INFO("--- Phase 1b: Biomes ---");
+
+    const int width = map->getWidth();
+    const int height = map->getHeight();
+    const size_t tileCount = static_cast<size_t>(width) * height;
+
+    // Step 1: Fields and biomes for this seed, salted so the two fields don't match
+    m_elevationNoise.reseed(settings.seed ^ 0x68bc21ebu);
+    m_moistureNoise.reseed(settings.seed ^ 0x02e5be93u);
+
+    const auto& sites = m_voronoi->getSites();
+    std::pmr::vector<BiomeBias> regionBias(sites.size(), BiomeBias{ 0.f, 0.f }, &m_arena);
+    for (size_t region = 0; region < sites.size(); ++region)
+        regionBias[region] = BIOME_BIASES[biomeForRegion(settings.seed, static_cast<int>(region))];
+
+    // Step 2: Clearings, same footprints the automata locks. Jobs only read this
+    std::pmr::vector<std::uint8_t> clearing(tileCount, 0, &m_arena);
+    auto clearTileRect = [&](sf::Vector2i minTile, sf::Vector2i maxTile, int padding)
+    {
+        const int minX = std::max(0, minTile.x - padding);
+        const int minY = std::max(0, minTile.y - padding);
+        const int maxX = std::min(width - 1, maxTile.x + padding);
+        const int maxY = std::min(height - 1, maxTile.y + padding);
+        for (int y = minY; y <= maxY; ++y)
+            std::fill_n(clearing.begin() + (static_cast<size_t>(y) * width + minX), maxX - minX + 1, std::uint8_t{ 1 });
+    };
+
+    for (const auto& poi : map->getPOIs())
+    {
+        const sf::FloatRect bounds = poi->getVisualBounds();
+        clearTileRect(map->worldToTile(bounds.position),
+            map->worldToTile(bounds.position + bounds.size), POI_CLEARING_TILES);
     }
 
-    std::cout << "Tiles per region:\n";
-    for (const auto& [regionId, count] : regionCounts)
+    for (const VoronoiSite& site : sites)
     {
-        std::cout << "  Region " << regionId << ": " << count << " tiles\n";
+        clearTileRect(site.tileCoords, site.tileCoords, SITE_CLEARING_TILES);
     }
+
+    // Step 3: Per band, both field rows first (straight loops over x), then classify the same
+    // rows while they're still in cache. Every tile writes only itself
+    std::pmr::vector<float> elevation(tileCount, 0.f, &m_arena);
+    std::pmr::vector<float> moisture(tileCount, 0.f, &m_arena);
+    const float frequency = settings.biomeFrequency;
+
+    constexpr int TERRAIN_TYPES = static_cast<int>(Terrain::POI_Collision) + 1;
+    std::array<std::atomic<int>, TERRAIN_TYPES> terrainCounts{};
+
+    JobSystem::parallelFor(0, height, VORONOI_ROWS_PER_JOB, [&](int rowBegin, int rowEnd)
+    {
+            std::array<int, TERRAIN_TYPES> bandCounts{};
+
+            for (int y = rowBegin; y < rowEnd; ++y)
+            {
+                float* elevationRow = elevation.data() + static_cast<size_t>(y) * width;
+                float* moistureRow = moisture.data() + static_cast<size_t>(y) * width;
+                const float sampleY = y * frequency;
+
+                for (int x = 0; x < width; ++x)
+                    elevationRow[x] = m_elevationNoise.simplexFbm<BIOME_OCTAVES>(x * frequency, sampleY);
+                for (int x = 0; x < width; ++x)
+                    moistureRow[x] = m_moistureNoise.simplexFbm<BIOME_OCTAVES>(x * frequency, sampleY);
+
+                for (int x = 0; x < width; ++x)
+                {
+                    MapTile* tile = map->getTile(x, y);
+
+                    // POI walls and anything unlabelled keep what they have
+                    const int region = tile->getVoronoiRegion();
+                    if (region < 0 || tile->getTerrainType() == Terrain::POI_Collision)
+                        continue;
+
+                    const BiomeBias& bias = regionBias[region];
+                    const float e = elevationRow[x] + bias.elevation;
+                    const float m = moistureRow[x] + bias.moisture;
+
+                    // Comparisons add up to the band index, no branches
+                    const int elevationBand = (e > ELEVATION_LOW) + (e > ELEVATION_HIGH);
+                    const int moistureBand = (m > MOISTURE_DRY) + (m > MOISTURE_WET);
+                    const Terrain terrain = BIOME_TERRAIN[clearing[static_cast<size_t>(y) * width + x]][elevationBand][moistureBand];
+
+                    tile->setTerrainType(terrain);
+                    tile->setWalkable(isWalkableTerrain(terrain));
+                    ++bandCounts[static_cast<int>(terrain)];
+                }
+            }
+
+            for (int i = 0; i < TERRAIN_TYPES; ++i)
+            {
+                if (bandCounts[i] > 0)
+                    terrainCounts[i].fetch_add(bandCounts[i], std::memory_order_relaxed);
+            }
+    });
+
+    GEN_LOG_INFO("Phase 1b complete: %d grass, %d forest, %d dirt, %d water, %d stone",
+        terrainCounts[static_cast<int>(Terrain::Grass)].load(),
+        terrainCounts[static_cast<int>(Terrain::Forest)].load(),
+        terrainCounts[static_cast<int>(Terrain::Dirt)].load(),
+        terrainCounts[static_cast<int>(Terrain::Water)].load(),
+        terrainCounts[static_cast<int>(Terrain::Stone)].load());
 }
 
 // ========================================================================================================
@@ -303,36 +1119,228 @@ void MapGenerator::phase1_Voronoi(Map* map, const GenerationSettings& settings)
 
 void MapGenerator::phase2_PerlinObjects(Map* map, const GenerationSettings& settings)
 {
-    std::cout << "\n--- Phase 2: Perlin Noise Object Placement ---\n";
+    PROFILE_ZONE("MapGenerator::phase2_PerlinObjects");
+
+    GEN_LOG_INFO("--- Phase 2: Perlin Noise Object Placement ---");
+
+    if (!ensureObjectAssets())
+        return;
+
+    // Configure placement settings, one layer per object kind, all placed in the same pass
+    ObjectPlacer::PlacementSettings placementSettings;
+    placementSettings.maxSpacing = settings.tileSize * 4.f;
+    placementSettings.respectPOIs = true;  // Don't place in POI areas
+
+    // Both layers are Grass only and biome patches run ~25 tiles, far past the sampler's
+    // 2 * maxSpacing step. That only works because the sampler keeps walking across ground
+    // accept turns down (PoissonSampler explore points). 10 seeds at 128x128: ~56% grass,
+    // 480-510 roots each, where growing only from accepted points placed 1-159
+
+    // Small roots fill in the clumps, first so they keep the noise pattern they always had
+    ObjectPlacer::PlacementLayer smallRoots;
+    smallRoots.objectType = WorldObject::Type::SmallRoot;
+    smallRoots.frequency = settings.objectFrequency;
+    smallRoots.octaves = settings.objectOctaves;
+    smallRoots.persistence = 0.5;
+    smallRoots.placementThreshold = settings.objectThreshold;
+    smallRoots.spacing = settings.tileSize * 1.5f;     // Old grid was every 2nd tile, clumps get a bit tighter
+    smallRoots.terrainMask = ObjectPlacer::terrainBit(MapTile::TerrainType::Grass);
+    smallRoots.priority = 0;
+    placementSettings.layers.push_back(smallRoots);
+
+    // Large roots are rarer, spread wider and claim their spot before small ones
+    ObjectPlacer::PlacementLayer largeRoots;
+    largeRoots.objectType = WorldObject::Type::LargeRoot;
+    largeRoots.frequency = settings.objectFrequency * 0.5;
+    largeRoots.octaves = settings.objectOctaves;
+    largeRoots.persistence = 0.5;
+    largeRoots.placementThreshold = std::min(settings.objectThreshold + 0.05, 0.95);
+    largeRoots.spacing = settings.tileSize * 3.f;
+    largeRoots.terrainMask = ObjectPlacer::terrainBit(MapTile::TerrainType::Grass);
+    largeRoots.priority = 1;
+    placementSettings.layers.push_back(largeRoots);
+
+    // Generate objects
+    m_objectPlacer->generateObjects(map, placementSettings, settings.seed);
 
+    GEN_LOG_INFO("Phase 2 complete: %d objects placed", m_objectPlacer->getObjectCount());
+}
+
+bool MapGenerator::ensureObjectAssets()
+{
     // Prevent assets being initalized again upon regeneration. 
-    if (!m_perlinAssetsInit)
+    if (m_perlinAssetsInit)
+        return true;
+
+    // Headless placers skip the atlas, everything but the sprites is the same
+    if (!m_objectPlacer->initialize(
+        m_headless ? std::string() : Assets::Textures::FOREST_ATLAS,
+        Assets::Data::FOREST_ATLAS_DEFINITIONS,
+        Assets::Maps::WORLD_OBJECTS_TEMPLATE))
+    {
+        std::cerr << "Failed to initialize ObjectPlacer!\n";
+        return false;
+    }
+
+    m_perlinAssetsInit = true;
+    return true;
+}
+
+// ========================================================================================================
+// PHASE 3: CELLULAR AUTOMATA REFINEMENT
+// - Random fill over the grass, then a few generations of the cave rules clump it into thickets
+// - POI footprints and Voronoi sites are locked so they always sit in open ground
+// ========================================================================================================
+void MapGenerator::phase3_CellularAutomata(Map* map, const GenerationSettings& settings)
+{
+    PROFILE_ZONE("MapGenerator::phase3_CellularAutomata");
+
+    GEN_LOG_INFO("--- Phase 3: Cellular Automata ---");
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const int width = map->getWidth();
+    const int height = map->getHeight();
+    m_automata.resize(width, height);
+
+    // Step 1: Random fill, only grass can turn into thicket
+    std::mt19937 rng(settings.seed);   // Resolved before the phases run, never 0 here
+    const float fillChance = std::clamp(settings.caFillChance, 0.f, 1.f);
+    const std::uint32_t fillThreshold = static_cast<std::uint32_t>(fillChance * 4294967295.0);
+
+    for (int y = 0; y < height; ++y)
     {
-        if (!m_objectPlacer->initialize(
-            Assets::Textures::FOREST_ATLAS,
-            Assets::Data::FOREST_ATLAS_DEFINITIONS,
-            Assets::Maps::WORLD_OBJECTS_TEMPLATE))
+        for (int x = 0; x < width; ++x)
         {
-            std::cerr << "Failed to initialize ObjectPlacer!\n";
-            return;
+            const MapTile* tile = map->getTile(x, y);
+            if (!tile || tile->getTerrainType() != MapTile::TerrainType::Grass)
+            {
+                m_automata.setLocked(x, y, true);
+                continue;
+            }
+
+            m_automata.setCell(x, y, rng() < fillThreshold);
         }
-        m_perlinAssetsInit = true;
     }
 
-    // Configure placement settings
-    ObjectPlacer::PlacementSettings placementSettings;
-    placementSettings.frequency = settings.objectFrequency;
-    placementSettings.octaves = settings.objectOctaves;
-    placementSettings.persistence = 0.5;
-    placementSettings.placementThreshold = settings.objectThreshold;
-    placementSettings.objectType = WorldObject::Type::SmallRoot;  // Testing with SmallRoot
-    placementSettings.respectPOIs = true;  // Don't place in POI areas
-    placementSettings.grassOnly = true;    // Only on grass terrain
+    // Step 2: Lock clearings, collision tiles only cover the walls so use the full visual bounds
+    auto lockTileRect = [&](sf::Vector2i minTile, sf::Vector2i maxTile, int padding)
+    {
+        for (int y = minTile.y - padding; y <= maxTile.y + padding; ++y)
+            for (int x = minTile.x - padding; x <= maxTile.x + padding; ++x)
+                m_automata.setLocked(x, y, true);   // Bounds checked
+    };
 
-    // Generate objects
-    m_objectPlacer->generateObjects(map, placementSettings, settings.seed);
+    for (const auto& poi : map->getPOIs())
+    {
+        const sf::FloatRect bounds = poi->getVisualBounds();
+        lockTileRect(map->worldToTile(bounds.position),
+            map->worldToTile(bounds.position + bounds.size), POI_CLEARING_TILES);
+    }
 
-    std::cout << "Phase 2 complete: " << m_objectPlacer->getObjectCount() << " objects placed\n";
+    for (const VoronoiSite& site : m_voronoi->getSites())
+    {
+        lockTileRect(site.tileCoords, site.tileCoords, SITE_CLEARING_TILES);
+    }
+
+    // Step 3: Run the generations
+    CellularAutomata::Rules rules;
+    rules.birthMask = settings.caBirthMask;
+    rules.survivalMask = settings.caSurvivalMask;
+    m_automata.run(rules, settings.caIterations, settings.caThreadCount);
+
+    // Step 4: Write the thickets back to the tiles
+    int thicketTiles = 0;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            if (!m_automata.getCell(x, y))
+                continue;
+
+            MapTile* tile = map->getTile(x, y);
+            tile->setTerrainType(MapTile::TerrainType::DeepForest);
+            tile->setWalkable(false);
+            ++thicketTiles;
+        }
+    }
+    m_report.thicketTiles = thicketTiles;
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+    GEN_LOG_INFO("Phase 3 complete: %d thicket tiles after %d generations (%.2f ms)",
+        thicketTiles, settings.caIterations, elapsed.count());
+}
+
+// ========================================================================================================
+// PHASE 4: CONNECTIVITY VALIDATION
+// - Every POI entrance and free Voronoi site has to be reachable from the hideout
+// - Anything cut off by the thickets gets the shortest possible corridor carved back
+// ========================================================================================================
+void MapGenerator::phase4_Connectivity(Map* map)
+{
+    PROFILE_ZONE("MapGenerator::phase4_Connectivity");
+
+    GEN_LOG_INFO("--- Phase 4: Connectivity Check ---");
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Step 1: Source is the hideout entrance, targets are the other POI entrances and the sites
+    const PointOfInterest* hideout = nullptr;
+    m_connectivityTargets.clear();
+
+    for (const auto& poi : map->getPOIs())
+    {
+        if (poi->getType() == PointOfInterest::Type::PlayerHideout)
+            hideout = poi.get();
+        else
+            m_connectivityTargets.push_back(getPOIEntranceTile(map, *poi));
+    }
+
+    if (!hideout)
+    {
+        LOG_WARN(MapGen, "Phase 4 skipped: no hideout on the map");
+        return;
+    }
+
+    // Sites under a POI are covered by that POI's entrance
+    for (const VoronoiSite& site : m_voronoi->getSites())
+    {
+        if (!map->isInsidePOI(site.position))
+            m_connectivityTargets.push_back(site.tileCoords);
+    }
+
+    const sf::Vector2i source = getPOIEntranceTile(map, *hideout);
+
+    // Step 2: Label, repair, then the distance field over the repaired map
+    m_connectivity.labelComponents(*map);
+    ConnectivityMap::Report report = m_connectivity.connectTargets(*map, source, m_connectivityTargets);
+    m_report.connectivity = report;
+    m_connectivity.buildDistanceField(*map, source);
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+    GEN_LOG_INFO("Phase 4 complete: %d components, %d/%d targets cut off, %d tiles carved (%.2f ms)",
+        report.componentCount, report.targetsUnreachable, report.targetsChecked,
+        report.tilesCarved, elapsed.count());
+
+    if (report.targetsSkipped > 0)
+    {
+        LOG_WARN(MapGen, "Phase 4: %d targets could not be connected (enclosed by POI walls)",
+            report.targetsSkipped);
+    }
+}
+
+sf::Vector2i MapGenerator::getPOIEntranceTile(const Map* map, const PointOfInterest& poi) const
+{
+    // PN: No door data in the templates yet, every POI sprite faces down so use the bottom middle
+    const sf::FloatRect bounds = poi.getVisualBounds();
+    const sf::Vector2f entrance(
+        bounds.position.x + bounds.size.x / 2.f,
+        bounds.position.y + bounds.size.y + map->getTileSize() / 2.f);
+
+    sf::Vector2i tile = map->worldToTile(entrance);
+    tile.x = std::clamp(tile.x, 0, map->getWidth() - 1);
+    tile.y = std::clamp(tile.y, 0, map->getHeight() - 1);
+    return tile;
 }
 
 // ========================================================================================================
@@ -356,10 +1364,8 @@ unsigned char MapGenerator::calSiteOptimalCount(SiteDensity density, const Gener
     // Min 3 max of 255
     siteCount = std::max<unsigned char>(3, std::min<unsigned char>(255, siteCount));
 
-    std::cout << "Auto-calculated site count:\n"
-        << "  Map area: " << totalArea << " px\n"
-        << "  Area per site: " << areaPerSite << " px per site\n"
-        << "  Calculated sites: " << static_cast<int>(siteCount) << "\n";
+    LOG_DEBUG(MapGen, "Auto-calculated site count: map area %.0f px, %.0f px per site, %d sites",
+        totalArea, areaPerSite, static_cast<int>(siteCount));
 
     return siteCount;
 }
@@ -398,21 +1404,23 @@ void MapGenerator::setupHideoutPOI(Map* map)
     );
 
     // Load hideout sprite
-    if (!hideout->loadSprite(Assets::Textures::HIDEOUT_SPRITE))
+    if (!m_headless && !hideout->loadSprite(Assets::Textures::HIDEOUT_SPRITE))
     {
         std::cerr << "Failed to load hideout sprite!\n";
     }
 
-    m_poiTemplates.applyTemplateCollision(hideout.get(), "hideout");
+    m_shared->poiTemplates.applyTemplateCollision(hideout.get(), "hideout");
 
-    std::cout << "Placed hideout at map center: (" 
-              << m_hideoutPosition.x << ", " << m_hideoutPosition.y << ")\n";
+    LOG_DEBUG(MapGen, "Placed hideout at map center: (%.1f, %.1f)",
+        m_hideoutPosition.x, m_hideoutPosition.y);
 
     map->addPOI(std::move(hideout));
 }
 
 void MapGenerator::spawnPOIsAtSites(Map* map, const GenerationSettings& settings)
 {
+    PROFILE_ZONE("MapGenerator::spawnPOIsAtSites");
+
     const auto& sites = m_voronoi->getSites();
 
     if (sites.empty())
@@ -432,7 +1440,7 @@ void MapGenerator::spawnPOIsAtSites(Map* map, const GenerationSettings& settings
 
     // Trying to sort sites by distance from hideout to the furthest first.
     // Issues with POIs being placed really close to the player spawn so it was redundant. 
-    std::vector<int> sitesByDistance(sites.size()); // Temp so sites are not modified
+    std::pmr::vector<int> sitesByDistance(sites.size(), &m_arena); // Temp so sites are not modified
     std::iota(sitesByDistance.begin(), sitesByDistance.end(), 0); // Pn: iota just uses iterators to fill values
 
     // Order the sites in reverse order, the furthest is first
@@ -448,12 +1456,11 @@ void MapGenerator::spawnPOIsAtSites(Map* map, const GenerationSettings& settings
             return distSq(sites[a].position) > distSq(sites[b].position);
     });
 
-    std::mt19937 rng(settings.seed == 0 ? std::random_device{}() : settings.seed);
+    std::mt19937 rng(settings.seed);   // Resolved before the phases run, never 0 here
     std::uniform_int_distribution<int> siteDist(0, static_cast<int>(sites.size()) - 1);
 
     int villagesLeft = settings.numVillages;
     int farmsLeft = settings.numFarms;
-    std::vector<bool> usedSites(sites.size(), false);
 
     sf::Vector2f worldSize = map->getWorldSize();
 
@@ -471,7 +1478,7 @@ void MapGenerator::spawnPOIsAtSites(Map* map, const GenerationSettings& settings
 
         PointOfInterest::Type poiType = getRandomPOIType(villagesLeft, farmsLeft, rng);
 
-        const POITypeConfig* config = m_poiConfig.getConfig(poiType);
+        const POITypeConfig* config = m_shared->poiConfig.getConfig(poiType);
         if (!config)
         {
             std::cerr << "No config found for POI type\n";
@@ -488,7 +1495,7 @@ void MapGenerator::spawnPOIsAtSites(Map* map, const GenerationSettings& settings
             site.position.y - halfHeight < edgeMargin ||
             site.position.y + halfHeight > worldSize.y - edgeMargin)
         {
-            std::cout << "Skipped site " << siteIndex << " - too close to map edge\n";
+            LOG_DEBUG(MapGen, "Skipped site %d - too close to map edge", static_cast<int>(siteIndex));
 
             // POI type was already decremented inside getRandomPOIType, just need to restore it
             if (poiType == PointOfInterest::Type::Village) ++villagesLeft;
@@ -504,8 +1511,8 @@ void MapGenerator::spawnPOIsAtSites(Map* map, const GenerationSettings& settings
 
         if (poi)
         {
-            std::cout << "Spawned " << poi->getName() << " at Voronoi site " << siteIndex
-                << " (pos: " << site.position.x << ", " << site.position.y << ")\n";
+            LOG_DEBUG(MapGen, "Spawned %s at Voronoi site %d (pos: %.1f, %.1f)",
+                poi->getName().c_str(), static_cast<int>(siteIndex), site.position.x, site.position.y);
 
             map->addPOI(std::move(poi));
             ++poisSpawned;
@@ -518,7 +1525,7 @@ void MapGenerator::spawnPOIsAtSites(Map* map, const GenerationSettings& settings
             << totalPOIs << " requested POIs\n";
     }
 
-    std::cout << "POI spawning complete: " << poisSpawned << " POIs placed\n";
+    GEN_LOG_INFO("POI spawning complete: %d POIs placed", static_cast<int>(poisSpawned));
 }
 
 
@@ -527,7 +1534,7 @@ std::unique_ptr<PointOfInterest> MapGenerator::createPOI(
     const sf::Vector2f& position,
     int instanceNumber)
 {
-    const POITypeConfig* config = m_poiConfig.getConfig(type);
+    const POITypeConfig* config = m_shared->poiConfig.getConfig(type);
     if (!config)
     {
         std::cerr << "Cannot create POI: No config for type\n";
@@ -543,7 +1550,7 @@ std::unique_ptr<PointOfInterest> MapGenerator::createPOI(
         config->size
     );
 
-    if (!config->spritePath.empty())
+    if (!m_headless && !config->spritePath.empty())
     {
         if (!poi->loadSprite(config->spritePath))
         {
@@ -557,9 +1564,9 @@ std::unique_ptr<PointOfInterest> MapGenerator::createPOI(
         std::transform(templateName.begin(), templateName.end(),
             templateName.begin(), ::tolower);
 
-        if (m_poiTemplates.hasTemplate(templateName))
+        if (m_shared->poiTemplates.hasTemplate(templateName))
         {
-            m_poiTemplates.applyTemplateCollision(poi.get(), templateName);
+            m_shared->poiTemplates.applyTemplateCollision(poi.get(), templateName);
         }
         else
         {
@@ -572,19 +1579,20 @@ std::unique_ptr<PointOfInterest> MapGenerator::createPOI(
 
 PointOfInterest::Type MapGenerator::getRandomPOIType(int& villagesLeft, int& farmsLeft, std::mt19937& rng)
 {
-    // Count remaining POI types
-    std::vector<PointOfInterest::Type> availableTypes;
+    // Count remaining POI types, fixed slots since this runs for every site every generation
+    std::array<PointOfInterest::Type, 2> availableTypes;
+    size_t availableCount = 0;
 
     if (villagesLeft > 0)
-        availableTypes.push_back(PointOfInterest::Type::Village);
+        availableTypes[availableCount++] = PointOfInterest::Type::Village;
     if (farmsLeft > 0)
-        availableTypes.push_back(PointOfInterest::Type::Farm);
+        availableTypes[availableCount++] = PointOfInterest::Type::Farm;
 
-    if (availableTypes.empty())
+    if (availableCount == 0)
         return PointOfInterest::Type::Landmark; // Fallback
 
-    // Pick random type from available
-    std::uniform_int_distribution<size_t> typeDist(0, availableTypes.size() - 1);
+    // Pick random type from available, same draw as before so seeds keep their POIs
+    std::uniform_int_distribution<size_t> typeDist(0, availableCount - 1);
     PointOfInterest::Type selectedType = availableTypes[typeDist(rng)];
 
     // Decrement counter
@@ -0,0 +1,326 @@
+#include "MapSnapshot.h"
+#include "Map.h"
+#include "VoronoiDiagram.h"
+#include "WorldObject.h"
+#include "PointOfInterest.h"
+#include "Profiler.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+// Records are memcpy'd straight in and out of the file, layout must not drift
+static_assert(std::is_trivially_copyable_v<MapSnapshot::Header>, "Snapshot header must be POD");
+static_assert(sizeof(MapSnapshot::Header) == 104, "Snapshot header layout changed, bump FILE_VERSION");
+static_assert(sizeof(MapSnapshot::SiteRecord) == 24, "SiteRecord layout changed, bump FILE_VERSION");
+static_assert(sizeof(MapSnapshot::POIRecord) == 16, "POIRecord layout changed, bump FILE_VERSION");
+static_assert(sizeof(MapSnapshot::ObjectRecord) == 12, "ObjectRecord layout changed, bump FILE_VERSION");
+static_assert(sizeof(MapSnapshot::SpawnRecord) == 8, "SpawnRecord layout changed, bump FILE_VERSION");
+
+namespace
+{
+    constexpr std::uint32_t SECTION_ALIGNMENT = 8;
+
+    std::uint32_t alignUp(size_t offset)
+    {
+        return static_cast<std::uint32_t>((offset + SECTION_ALIGNMENT - 1) & ~size_t(SECTION_ALIGNMENT - 1));
+    }
+
+    // Reserves a section at the end of the buffer and returns a pointer to it
+    template<typename T>
+    T* appendSection(std::vector<std::uint8_t>& out, MapSnapshot::Section& section, size_t count)
+    {
+        section.offset = alignUp(out.size());
+        section.count = static_cast<std::uint32_t>(count);
+        out.resize(section.offset + count * sizeof(T), 0);
+        return reinterpret_cast<T*>(out.data() + section.offset);
+    }
+
+    // "Farm 2" -> 2, POIs only keep the display name
+    std::int32_t parseInstanceNumber(const std::string& name)
+    {
+        const size_t space = name.find_last_of(' ');
+        if (space == std::string::npos || space + 1 >= name.size())
+            return 1;
+
+        std::int32_t value = 0;
+        for (size_t i = space + 1; i < name.size(); ++i)
+        {
+            if (name[i] < '0' || name[i] > '9')
+                return 1;
+            value = value * 10 + (name[i] - '0');
+        }
+        return value;
+    }
+
+    bool sectionFits(const MapSnapshot::Section& section, size_t elementSize, size_t fileSize, size_t headerSize)
+    {
+        if (section.count == 0)
+            return true;
+        if (section.offset < headerSize || section.offset % SECTION_ALIGNMENT != 0)
+            return false;
+        return static_cast<std::uint64_t>(section.offset) + std::uint64_t(section.count) * elementSize <= fileSize;
+    }
+}
+
+MapSnapshot::MapSnapshot()
+    : m_data(nullptr)
+    , m_size(0)
+    , m_header(nullptr)
+{
+}
+
+// ========================================================================================================
+// WRITING
+// ========================================================================================================
+void MapSnapshot::build(const Contents& contents, std::vector<std::uint8_t>& out)
+{
+    PROFILE_ZONE("MapSnapshot::build");
+
+    out.clear();
+    if (!contents.map)
+        return;
+
+    const Map& map = *contents.map;
+    const size_t tileCount = static_cast<size_t>(map.getWidth()) * map.getHeight();
+
+    // Header is filled last, the sections resize the buffer as they go
+    Header header{};
+    out.resize(sizeof(Header), 0);
+
+    // ========== Tiles ==========
+    std::uint8_t* terrain = appendSection<std::uint8_t>(out, header.terrain, tileCount);
+    for (size_t i = 0; i < tileCount; ++i)
+    {
+        const MapTile* tile = map.getTile(static_cast<int>(i % map.getWidth()), static_cast<int>(i / map.getWidth()));
+        terrain[i] = static_cast<std::uint8_t>(tile->getTerrainType());
+    }
+
+    std::uint8_t* walkable = appendSection<std::uint8_t>(out, header.walkable, tileCount);
+    for (size_t i = 0; i < tileCount; ++i)
+    {
+        const MapTile* tile = map.getTile(static_cast<int>(i % map.getWidth()), static_cast<int>(i / map.getWidth()));
+        walkable[i] = tile->isWalkable() ? 1 : 0;
+    }
+
+    std::int32_t* regions = appendSection<std::int32_t>(out, header.regions, tileCount);
+    for (size_t i = 0; i < tileCount; ++i)
+    {
+        const MapTile* tile = map.getTile(static_cast<int>(i % map.getWidth()), static_cast<int>(i / map.getWidth()));
+        regions[i] = tile->getVoronoiRegion();
+    }
+
+    // ========== Voronoi Sites ==========
+    const size_t siteCount = contents.sites ? contents.sites->size() : 0;
+    SiteRecord* sites = appendSection<SiteRecord>(out, header.sites, siteCount);
+    for (size_t i = 0; i < siteCount; ++i)
+    {
+        const VoronoiSite& site = (*contents.sites)[i];
+        SiteRecord& record = sites[i];
+        record.x = site.position.x;
+        record.y = site.position.y;
+        record.tileX = site.tileCoords.x;
+        record.tileY = site.tileCoords.y;
+        record.regionId = site.regionId;
+        record.r = site.debugColor.r;
+        record.g = site.debugColor.g;
+        record.b = site.debugColor.b;
+        record.hasPOI = site.hasPOI ? 1 : 0;
+    }
+
+    // ========== POIs ==========
+    const auto& pois = map.getPOIs();
+    POIRecord* poiRecords = appendSection<POIRecord>(out, header.pois, pois.size());
+    for (size_t i = 0; i < pois.size(); ++i)
+    {
+        POIRecord& record = poiRecords[i];
+        record.type = static_cast<std::uint8_t>(pois[i]->getType());
+        record.instance = parseInstanceNumber(pois[i]->getName());
+        record.x = pois[i]->getPosition().x;
+        record.y = pois[i]->getPosition().y;
+    }
+
+    // ========== World Objects ==========
+    const size_t objectCount = contents.objects ? contents.objects->size() : 0;
+    ObjectRecord* objects = appendSection<ObjectRecord>(out, header.objects, objectCount);
+    for (size_t i = 0; i < objectCount; ++i)
+    {
+        const WorldObject& object = (*contents.objects)[i];
+        objects[i].type = static_cast<std::uint8_t>(object.getType());
+        objects[i].x = object.getPosition().x;
+        objects[i].y = object.getPosition().y;
+    }
+
+    // ========== Spawns ==========
+    auto writeSpawns = [&](Section& section, const std::vector<sf::Vector2f>* points)
+    {
+        const size_t count = points ? points->size() : 0;
+        SpawnRecord* records = appendSection<SpawnRecord>(out, section, count);
+        for (size_t i = 0; i < count; ++i)
+            records[i] = { (*points)[i].x, (*points)[i].y };
+    };
+
+    writeSpawns(header.enemySpawns, contents.enemySpawns);
+    writeSpawns(header.itemSpawns, contents.itemSpawns);
+
+    out.resize(alignUp(out.size()), 0);
+
+    // ========== Header ==========
+    header.magic = FILE_MAGIC;
+    header.version = FILE_VERSION;
+    header.headerSize = sizeof(Header);
+    header.seed = contents.seed;
+    header.width = static_cast<std::uint16_t>(map.getWidth());
+    header.height = static_cast<std::uint16_t>(map.getHeight());
+    header.tileSize = map.getTileSize();
+    header.payloadSize = out.size() - sizeof(Header);
+    header.checksum = computeChecksum(out.data() + sizeof(Header), static_cast<size_t>(header.payloadSize));
+
+    std::memcpy(out.data(), &header, sizeof(Header));
+}
+
+bool MapSnapshot::writeFile(const std::string& filePath, const std::vector<std::uint8_t>& bytes)
+{
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "MapSnapshot: Failed to open " << filePath << " for writing\n";
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file.good())
+    {
+        std::cerr << "MapSnapshot: Write failed for " << filePath << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+// ========================================================================================================
+// LOADING
+// ========================================================================================================
+bool MapSnapshot::loadFile(const std::string& filePath)
+{
+    PROFILE_ZONE("MapSnapshot::loadFile");
+
+    close();
+
+    if (!m_file.open(filePath))
+    {
+        std::cerr << "MapSnapshot: Failed to map " << filePath << "\n";
+        return false;
+    }
+
+    if (!attach(m_file.data(), m_file.size(), filePath))
+    {
+        m_file.close();
+        return false;
+    }
+
+    return true;
+}
+
+bool MapSnapshot::loadBytes(std::vector<std::uint8_t>&& bytes)
+{
+    close();
+
+    m_ownedBytes = std::move(bytes);
+    if (!attach(m_ownedBytes.data(), m_ownedBytes.size(), "memory"))
+    {
+        m_ownedBytes.clear();
+        return false;
+    }
+
+    return true;
+}
+
+void MapSnapshot::close()
+{
+    m_header = nullptr;
+    m_data = nullptr;
+    m_size = 0;
+    m_file.close();
+    m_ownedBytes.clear();
+}
+
+bool MapSnapshot::attach(const std::uint8_t* data, size_t size, const std::string& source)
+{
+    if (!data || size < sizeof(Header))
+    {
+        std::cerr << "MapSnapshot: " << source << " is too small to be a snapshot\n";
+        return false;
+    }
+
+    // Mapped views are page aligned and vector storage is new'd, both are fine for every record type
+    const Header* header = reinterpret_cast<const Header*>(data);
+
+    if (header->magic != FILE_MAGIC)
+    {
+        std::cerr << "MapSnapshot: " << source << " is not a map snapshot\n";
+        return false;
+    }
+
+    if (header->version != FILE_VERSION || header->headerSize != sizeof(Header))
+    {
+        std::cerr << "MapSnapshot: " << source << " is version " << header->version
+            << ", expected " << FILE_VERSION << "\n";
+        return false;
+    }
+
+    if (header->payloadSize != size - sizeof(Header))
+    {
+        std::cerr << "MapSnapshot: " << source << " is truncated\n";
+        return false;
+    }
+
+    const size_t tileCount = static_cast<size_t>(header->width) * header->height;
+    const bool tilesMatch = header->terrain.count == tileCount
+        && header->walkable.count == tileCount
+        && header->regions.count == tileCount;
+
+    const bool sectionsFit = sectionFits(header->terrain, sizeof(std::uint8_t), size, sizeof(Header))
+        && sectionFits(header->walkable, sizeof(std::uint8_t), size, sizeof(Header))
+        && sectionFits(header->regions, sizeof(std::int32_t), size, sizeof(Header))
+        && sectionFits(header->sites, sizeof(SiteRecord), size, sizeof(Header))
+        && sectionFits(header->pois, sizeof(POIRecord), size, sizeof(Header))
+        && sectionFits(header->objects, sizeof(ObjectRecord), size, sizeof(Header))
+        && sectionFits(header->enemySpawns, sizeof(SpawnRecord), size, sizeof(Header))
+        && sectionFits(header->itemSpawns, sizeof(SpawnRecord), size, sizeof(Header));
+
+    if (!tilesMatch || !sectionsFit)
+    {
+        std::cerr << "MapSnapshot: " << source << " has a corrupt section table\n";
+        return false;
+    }
+
+    {
+        PROFILE_ZONE("MapSnapshot::checksum");
+        if (computeChecksum(data + sizeof(Header), size - sizeof(Header)) != header->checksum)
+        {
+            std::cerr << "MapSnapshot: " << source << " failed its checksum\n";
+            return false;
+        }
+    }
+
+    m_data = data;
+    m_size = size;
+    m_header = header;
+    return true;
+}
+
+// ========================================================================================================
+// CHECKSUM
+// ========================================================================================================
+std::uint64_t MapSnapshot::computeChecksum(const std::uint8_t* data, size_t size)
+{
+    // FNV-1a 64, catches truncation and bit flips, not meant to stop tampering
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
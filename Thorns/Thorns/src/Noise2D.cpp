@@ -0,0 +1,67 @@
+#include "Noise2D.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+Noise2D::Noise2D()
+{
+    // Identity permutation until reseed() shuffles it
+    std::iota(m_permutation.begin(), m_permutation.begin() + 256, 0);
+    std::copy(m_permutation.begin(), m_permutation.begin() + 256, m_permutation.begin() + 256);
+}
+
+Noise2D::Noise2D(std::uint32_t seed)
+{
+    reseed(seed);
+}
+
+void Noise2D::reseed(std::uint32_t seed)
+{
+    // Fill with ordered sequence 0-255
+    std::iota(m_permutation.begin(), m_permutation.begin() + 256, 0);
+
+    // Fisher-Yates by hand with mt19937, std::shuffle and default_random_engine both differ
+    // between standard libraries and the noise feeds cached maps
+    std::mt19937 engine(seed);
+    for (int i = 255; i > 0; --i)
+    {
+        const int j = static_cast<int>(engine() % static_cast<std::uint32_t>(i + 1));
+        std::swap(m_permutation[i], m_permutation[j]);
+    }
+
+    // Duplicate for wrapping
+    std::copy(m_permutation.begin(), m_permutation.begin() + 256, m_permutation.begin() + 256);
+}
+
+// ========================================================================================================
+// RUNTIME OCTAVES
+// ========================================================================================================
+float Noise2D::perlinFbm(float x, float y, int octaves, float persistence) const
+{
+    switch (std::clamp(octaves, 1, MAX_OCTAVES))
+    {
+    case 1: return perlinFbm<1>(x, y, persistence);
+    case 2: return perlinFbm<2>(x, y, persistence);
+    case 3: return perlinFbm<3>(x, y, persistence);
+    case 4: return perlinFbm<4>(x, y, persistence);
+    case 5: return perlinFbm<5>(x, y, persistence);
+    case 6: return perlinFbm<6>(x, y, persistence);
+    case 7: return perlinFbm<7>(x, y, persistence);
+    default: return perlinFbm<8>(x, y, persistence);
+    }
+}
+
+float Noise2D::simplexFbm(float x, float y, int octaves, float persistence) const
+{
+    switch (std::clamp(octaves, 1, MAX_OCTAVES))
+    {
+    case 1: return simplexFbm<1>(x, y, persistence);
+    case 2: return simplexFbm<2>(x, y, persistence);
+    case 3: return simplexFbm<3>(x, y, persistence);
+    case 4: return simplexFbm<4>(x, y, persistence);
+    case 5: return simplexFbm<5>(x, y, persistence);
+    case 6: return simplexFbm<6>(x, y, persistence);
+    case 7: return simplexFbm<7>(x, y, persistence);
+    default: return simplexFbm<8>(x, y, persistence);
+    }
+}
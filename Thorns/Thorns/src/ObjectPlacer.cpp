@@ -1,17 +1,48 @@
 ﻿#include "ObjectPlacer.h"
 #include "Map.h"
 #include "MapTile.h"
+#include "PointOfInterest.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <random>
 #include "AssetPaths.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include "AssetTables.h"
+
+static_assert(std::size(AssetTables::FOREST_ATLAS) == static_cast<size_t>(WorldObject::Type::COUNT),
+    "forest-atlas-points.txt is missing a WorldObject::Type, update Tools/generate_asset_tables.py and rerun it");
+
+// Scale down large objects to fit in world better
+static constexpr float OBJECT_SCALE = 0.5f;
+
+// Offset between layers in the 2D noise plane, non integer and different per axis so no two layers
+// sit on the same lattice
+static constexpr float LAYER_NOISE_OFFSET_X = 7.31f;
+static constexpr float LAYER_NOISE_OFFSET_Y = 11.57f;
 
 ObjectPlacer::ObjectPlacer()
-    : m_perlin(nullptr)
-    , m_initialized(false)
+    : m_initialized(false)
     , m_atlasTextureLoaded(false)
 {
+    registerDefinitions();
+}
+
+void ObjectPlacer::registerDefinitions()
+{
+    for (size_t i = 0; i < EnumMap<WorldObject::Type, ObjectDefinition>::CAPACITY; ++i)
+    {
+        const AssetTables::AtlasEntry& atlas = AssetTables::FOREST_ATLAS[i];
+
+        ObjectDefinition& def = m_definitions[static_cast<WorldObject::Type>(i)];
+        def.name = atlas.key;
+        def.textureRect = sf::IntRect(sf::Vector2i(atlas.x, atlas.y), sf::Vector2i(atlas.width, atlas.height));
+        def.size = sf::Vector2f(atlas.width * OBJECT_SCALE, atlas.height * OBJECT_SCALE);
+    }
 }
 
 // Documentation notes:
@@ -24,25 +55,32 @@ bool ObjectPlacer::initialize(const std::string& atlasPath,
                               const std::string& collisionTmxPath)
 {
     m_atlasPath = atlasPath;
+    m_headless = atlasPath.empty();
 
-    if (!m_sharedAtlasTexture.loadFromFile(atlasPath))
+    if (m_headless)
+    {
+        m_atlasTextureLoaded = false;
+        LOG_DEBUG(Objects, "ObjectPlacer: Headless, no texture atlas");
+    }
+    else if (!m_sharedAtlasTexture.loadFromFile(atlasPath))
     {
         std::cerr << "ObjectPlacer: Failed to load texture atlas: " << atlasPath << "\n";
         m_atlasTextureLoaded = false;
         return false;
     }
-
-    m_atlasTextureLoaded = true;
-    std::cout << "ObjectPlacer: Loaded shared texture atlas: " << atlasPath << "\n";
-
-    if (m_templateManager.loadTemplates(Assets::Maps::WORLD_OBJECTS_TEMPLATE)) {
-        m_templatesLoaded = true;
-    }
     else
+    {
+        m_atlasTextureLoaded = true;
+        LOG_DEBUG(Objects, "ObjectPlacer: Loaded shared texture atlas: %s", atlasPath.c_str());
+    }
+
+    m_templateManager = WorldObjectTemplateManager::loadShared(
+        collisionTmxPath.empty() ? Assets::Maps::WORLD_OBJECTS_TEMPLATE : collisionTmxPath);
+    if (!m_templateManager)
         std::cerr << "ObjectPlacer: Failed to load world object templates for TMX collisions\n";
 
 
-    // Parse object definitions
+    // Definitions are already in from the generated table, debug builds check them against the file
     if (!parseDefinitions(definitionsPath))
     {
         std::cerr << "ObjectPlacer: Failed to parse definitions from " << definitionsPath << "\n";
@@ -51,12 +89,16 @@ bool ObjectPlacer::initialize(const std::string& atlasPath,
 
 
     m_initialized = true;
-    std::cout << "ObjectPlacer initialized with " << m_definitions.size() << " object types\n";
+    LOG_DEBUG(Objects, "ObjectPlacer initialized with %zu object types", m_definitions.size());
     return true;
 }
 
 bool ObjectPlacer::parseDefinitions(const std::string& definitionsPath)
 {
+#ifndef _DEBUG
+    (void)definitionsPath;
+    return true;
+#else
     std::ifstream file(definitionsPath);
     if (!file.is_open())
     {
@@ -64,6 +106,7 @@ bool ObjectPlacer::parseDefinitions(const std::string& definitionsPath)
         return false;
     }
 
+    int loaded = 0;
     std::string line;
     while (std::getline(file, line))
     {
@@ -80,40 +123,40 @@ bool ObjectPlacer::parseDefinitions(const std::string& definitionsPath)
         std::getline(ss, name, ',');
         ss >> x >> comma >> y >> comma >> width >> comma >> height;
 
-        // Map name to type
-        WorldObject::Type type;
-        if (name == "SmallRoot")
-            type = WorldObject::Type::SmallRoot;
-        else if (name == "TreeTop_1")
-            type = WorldObject::Type::TreeTop1;
-        else if (name == "TreeTop_2")
-            type = WorldObject::Type::TreeTop2;
-        else if (name == "LargeRoot")
-            type = WorldObject::Type::LargeRoot;
-        else if (name == "SmallRoot_Basic")
-            type = WorldObject::Type::SmallRootBasic;
-        else
+        // Map name to type, keys live in the generated table
+        ObjectDefinition* found = nullptr;
+        for (auto [type, candidate] : m_definitions)
         {
-            std::cout << "Unknown object type: " << name << ", skipping...\n";
-            continue;
+            if (candidate.name == name)
+            {
+                found = &candidate;
+                break;
+            }
         }
 
-        // Store definition
-        ObjectDefinition def;
-        def.name = name;
-        def.textureRect = sf::IntRect(sf::Vector2i(x, y), sf::Vector2i(width, height));
-
-        // Scale down large objects to fit in world better
-        float scale = 0.5f;
-        def.size = sf::Vector2f(width * scale, height * scale);
+        if (!found)
+        {
+            LOG_WARN(Objects, "Unknown object type: %s, skipping...", name.c_str());
+            continue;
+        }
 
-        m_definitions[type] = def;
+        // File wins in debug so atlas edits show up straight away, but flag the stale header
+        ObjectDefinition& def = *found;
+        const sf::IntRect rect(sf::Vector2i(x, y), sf::Vector2i(width, height));
+        if (def.textureRect != rect)
+        {
+            LOG_WARN(Objects, "%s '%s' differs from AssetTables.h, rerun Tools/generate_asset_tables.py",
+                definitionsPath.c_str(), name.c_str());
+            def.textureRect = rect;
+            def.size = sf::Vector2f(width * OBJECT_SCALE, height * OBJECT_SCALE);
+        }
+        ++loaded;
 
-        std::cout << "Loaded object: " << name << " at (" << x << "," << y
-            << ") size " << width << "x" << height << "\n";
+        LOG_DEBUG(Objects, "Loaded object: %s at (%d,%d) size %dx%d", name.c_str(), x, y, width, height);
     }
 
-    return !m_definitions.empty();
+    return loaded > 0;
+#endif
 }
 
 // Maps WorldObject type to the collision shape name in the TMX file
@@ -141,98 +184,228 @@ void ObjectPlacer::generateObjects(Map* map, const PlacementSettings& settings,
     // Clear existing objects
     clearObjects();
 
-    // Initialize Perlin noise with seed
-    m_perlin = std::make_unique<PerlinNoise>(seed);
+    // Reseed the 2D noise, the permutation is a member so this allocates nothing
+    m_noise.reseed(seed);
 
-    std::cout << "\n--- Phase 2: Perlin Noise Object Placement ---\n";
-    std::cout << "Parameters:\n";
-    std::cout << "  Frequency: " << settings.frequency << "\n";
-    std::cout << "  Octaves: " << settings.octaves << "\n";
-    std::cout << "  Threshold: " << settings.placementThreshold << "\n";
-    std::cout << "  Object Type: " << static_cast<int>(settings.objectType) << "\n";
+    LOG_DEBUG(Objects, "--- Phase 2: Perlin Noise Object Placement ---");
 
-    // Get object definition
-    const ObjectDefinition* def = getDefinition(settings.objectType);
-    if (!def)
+    // Every buffer below is gone when this returns, on the generator's arena that costs nothing
+    PlacementScratch scratch(m_scratch ? m_scratch : std::pmr::get_default_resource());
+
+    // Layers highest priority first, stable so equal priorities keep their list order.
+    // Layers without a definition are dropped here instead of per candidate
+    const auto& layers = settings.layers;
+    scratch.layerOrder.clear();
+    for (int i = 0; i < static_cast<int>(layers.size()); ++i)
     {
-        std::cerr << "No definition found for object type\n";
-        return;
+        if (!getDefinition(layers[i].objectType))
+        {
+            std::cerr << "No definition found for object type " << static_cast<int>(layers[i].objectType) << "\n";
+            continue;
+        }
+
+        scratch.layerOrder.push_back(i);
+        LOG_DEBUG(Objects, "Layer %d: type %d, frequency %.4f, octaves %d, threshold %.3f, spacing %.0f, priority %d",
+            i, static_cast<int>(layers[i].objectType), layers[i].frequency, layers[i].octaves,
+            layers[i].placementThreshold, layers[i].spacing, layers[i].priority);
     }
 
-    const sf::Vector2f tmxOrigin(0.f, 0.f);
+    if (scratch.layerOrder.empty())
+        return;
 
-    // Sample every (n)th tile, might change depending on performance later
-    const int sampleStep = 2;  // Check every 2nd tile
+    std::stable_sort(scratch.layerOrder.begin(), scratch.layerOrder.end(),
+        [&layers](int a, int b) { return layers[a].priority > layers[b].priority; });
 
-    int width = map->getWidth();
-    int height = map->getHeight();
-    int objectsPlaced = 0;
-    int tilesChecked = 0;
+    // Hybrid: Perlin for density, Poisson for exact positions (see notes at the bottom)
+    // Candidates are as dense as the tightest layer needs, resolvePlacements spaces out the rest
+    double minSpacing = layers[scratch.layerOrder[0]].spacing;
+    for (int index : scratch.layerOrder)
+        minSpacing = std::min(minSpacing, layers[index].spacing);
 
-    // Iterate through map tiles
-    for (int y = 0; y < height; y += sampleStep)
-    {
-        for (int x = 0; x < width; x += sampleStep)
-        {
-            ++tilesChecked;
+    PoissonSampler::Params params;
+    params.bounds = sf::FloatRect(sf::Vector2f(0.f, 0.f), map->getWorldSize());
+    params.minRadius = static_cast<float>(minSpacing);
+    params.maxRadius = static_cast<float>(std::max(minSpacing, settings.maxSpacing));
+
+    // POI footprints come from the map's occupancy layer, one tile lookup per candidate
+    m_sampler.clearExclusions();
 
-            // Get world position (center of tile)
-            sf::Vector2f worldPos = map->tileToWorld(x, y);
+    // The sampler calls density then accept for the same candidate, so the shared checks and the
+    // per layer noise run once in density and accept just reads the results back
+    scratch.layerNoise.assign(layers.size(), 0.f);
+    scratch.sampleLayers.clear();
+    bool candidateValid = false;
+    MapTile::TerrainType candidateTerrain = MapTile::TerrainType::UNKNOWN;
 
-            // Check if this location is valid for placement
-            if (!isValidPlacement(worldPos, map, settings))
+    auto density = [&](const sf::Vector2f& pos)
+    {
+        candidateValid = isValidPlacement(pos, map, candidateTerrain)
+            && !(settings.respectPOIs && map->isInsidePOI(pos));
+        if (!candidateValid)
+            return 0.f;
+
+        float best = 0.f;
+        for (int index : scratch.layerOrder)
+        {
+            const PlacementLayer& layer = layers[index];
+            if (!(layer.terrainMask & terrainBit(candidateTerrain)))
+            {
+                scratch.layerNoise[index] = 0.f;
                 continue;
+            }
 
-            // Generate noise value at this position
-            // Apply frequency to zoom in/out
-            double noiseValue = m_perlin->octaveNoise2D(
-                worldPos.x * settings.frequency,
-                worldPos.y * settings.frequency,
-                settings.octaves,
-                settings.persistence
+            // Each layer reads its own patch of the noise plane so two layers with the same
+            // frequency don't clump in the same spots
+            const float frequency = static_cast<float>(layer.frequency);
+            scratch.layerNoise[index] = m_noise.perlinFbm(
+                pos.x * frequency + index * LAYER_NOISE_OFFSET_X,
+                pos.y * frequency + index * LAYER_NOISE_OFFSET_Y,
+                layer.octaves,
+                static_cast<float>(layer.persistence)
             );
 
-            // Check threshold
-            if (noiseValue > settings.placementThreshold)
+            // Tightest spacing at the noise peaks, loosest at or under the threshold
+            const double range = std::max(1.0 - layer.placementThreshold, 0.0001);
+            best = std::max(best, static_cast<float>((scratch.layerNoise[index] - layer.placementThreshold) / range));
+        }
+        return best;
+    };
+
+    auto accept = [&](const sf::Vector2f&)
+    {
+        if (!candidateValid)
+            return false;
+
+        // Highest priority layer above its threshold claims the spot
+        for (int index : scratch.layerOrder)
+        {
+            if ((layers[index].terrainMask & terrainBit(candidateTerrain))
+                && scratch.layerNoise[index] > layers[index].placementThreshold)
             {
-                // Create object
-                auto object = std::make_unique<WorldObject>(settings.objectType, worldPos);
+                // Accept is the sampler's last check, a true here always becomes a sample
+                scratch.sampleLayers.push_back(index);
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::mt19937 rng(seed);
+    const size_t candidates = m_sampler.sample(params, rng, scratch.samplePoints, density, accept);
+
+    const int objectsPlaced = resolvePlacements(settings, map->getWorldSize(), scratch);
+
+    LOG_DEBUG(Objects, "Object placement complete: %zu Poisson samples, %d objects placed over %zu layer(s)",
+        candidates, objectsPlaced, scratch.layerOrder.size());
+}
+
+int ObjectPlacer::resolvePlacements(const PlacementSettings& settings, const sf::Vector2f& worldSize,
+    PlacementScratch& scratch)
+{
+    PROFILE_ZONE("ObjectPlacer::resolvePlacements");
+
+    const auto& layers = settings.layers;
+    const int count = static_cast<int>(scratch.samplePoints.size());
+
+    // Highest priority first, sample order within a priority so the result stays seed stable
+    scratch.placementOrder.resize(count);
+    std::iota(scratch.placementOrder.begin(), scratch.placementOrder.end(), 0);
+    std::stable_sort(scratch.placementOrder.begin(), scratch.placementOrder.end(), [&](int a, int b)
+    {
+            return layers[scratch.sampleLayers[a]].priority > layers[scratch.sampleLayers[b]].priority;
+    });
+
+    // Grid cells are as wide as the largest spacing, so a 3x3 block covers any conflict
+    double maxSpacing = 1.0;
+    for (int index : scratch.layerOrder)
+        maxSpacing = std::max(maxSpacing, layers[index].spacing);
+
+    const float cellSize = static_cast<float>(maxSpacing);
+    const int gridWidth = static_cast<int>(std::ceil(worldSize.x / cellSize));
+    const int gridHeight = static_cast<int>(std::ceil(worldSize.y / cellSize));
+    scratch.cellHeads.assign(static_cast<size_t>(gridWidth) * gridHeight, -1);
+    scratch.cellNext.assign(count, -1);
+
+    EnumMap<WorldObject::Type, int> placedPerType;
+    int objectsPlaced = 0;
+    m_objects.reserve(count);
+
+    for (int sample : scratch.placementOrder)
+    {
+        const sf::Vector2f& pos = scratch.samplePoints[sample];
+        const double spacing = layers[scratch.sampleLayers[sample]].spacing;
+        const int cellX = std::min(static_cast<int>(pos.x / cellSize), gridWidth - 1);
+        const int cellY = std::min(static_cast<int>(pos.y / cellSize), gridHeight - 1);
 
-                // Load sprite from atlas
-                if (object->loadSpriteFromTexture(m_sharedAtlasTexture, def->textureRect, def->size))
+        bool blocked = false;
+        for (int y = std::max(0, cellY - 1); y <= std::min(gridHeight - 1, cellY + 1) && !blocked; ++y)
+        {
+            for (int x = std::max(0, cellX - 1); x <= std::min(gridWidth - 1, cellX + 1) && !blocked; ++x)
+            {
+                for (int other = scratch.cellHeads[y * gridWidth + x]; other >= 0; other = scratch.cellNext[other])
                 {
-                    if (m_templatesLoaded)
+                    // Either object's spacing keeps the other out
+                    const double required = std::max(spacing, layers[scratch.sampleLayers[other]].spacing);
+                    const sf::Vector2f d = pos - scratch.samplePoints[other];
+                    if (d.x * d.x + d.y * d.y < required * required)
                     {
-                        const auto* shapes = m_templateManager.getShapes(settings.objectType);
-                        if (shapes) {
-                            object->setCollisionShapes(shapes, tmxOrigin);
-                            std::cout << "Object at (" << worldPos.x << "," << worldPos.y
-                                << ") got " << shapes->size() << " shape(s)\n";
-                        }
-
+                        blocked = true;
+                        break;
                     }
-                    m_objects.push_back(std::move(object));
-                    ++objectsPlaced;
                 }
             }
         }
+
+        const WorldObject::Type type = layers[scratch.sampleLayers[sample]].objectType;
+        if (blocked || !placeObject(type, pos))
+            continue;
+
+        const int cell = cellY * gridWidth + cellX;
+        scratch.cellNext[sample] = scratch.cellHeads[cell];
+        scratch.cellHeads[cell] = sample;
+
+        ++placedPerType[type];
+        ++objectsPlaced;
+    }
+
+    for (auto [type, placed] : placedPerType)
+        LOG_DEBUG(Objects, "  type %d: %d placed", static_cast<int>(type), placed);
+
+    return objectsPlaced;
+}
+
+bool ObjectPlacer::placeObject(WorldObject::Type type, const sf::Vector2f& worldPos)
+{
+    const ObjectDefinition* def = getDefinition(type);
+    if (!m_initialized || !def)
+        return false;
+
+    // Sprite needs the shared atlas, nothing is drawn without it. Headless only wants the layout
+    if (!m_atlasTextureLoaded && !m_headless)
+        return false;
+
+    const std::vector<CollisionShape>* shapes = nullptr;
+    if (m_templateManager)
+    {
+        shapes = m_templateManager->getShapes(type);
+        if (shapes) {
+            LOG_TRACE(Objects, "Object at (%.1f,%.1f) got %zu shape(s)",
+                worldPos.x, worldPos.y, shapes->size());
+        }
     }
 
-    std::cout << "Object placement complete:\n";
-    std::cout << "  Tiles checked: " << tilesChecked << "\n";
-    std::cout << "  Objects placed: " << objectsPlaced << "\n";
-    std::cout << "  Placement rate: " << (objectsPlaced * 100.0 / tilesChecked) << "%\n";
+    m_objects.emplace_back(type, worldPos, def->size, shapes);
+    return true;
 }
 
 void ObjectPlacer::clearObjects()
 {
     m_objects.clear();
-    m_perlin.reset();
 }
 
 void ObjectPlacer::render(sf::RenderTarget& target, const sf::View& view) const
 {
-    if (m_objects.empty())
+    if (m_objects.empty() || !m_atlasTextureLoaded)
         return;
 
     // Get view frustum for culling
@@ -250,19 +423,40 @@ void ObjectPlacer::render(sf::RenderTarget& target, const sf::View& view) const
     viewBounds.size.x += padding * 2.f;
     viewBounds.size.y += padding * 2.f;
 
-    // Render only visible objects
-    int rendered = 0;
-    for (const auto& object : m_objects)
+    // Build a textured quad per visible object, list order is kept so overlaps draw as before
+    m_batchVertices.setPrimitiveType(sf::PrimitiveType::Triangles);
+    m_batchVertices.clear();
+
+    for (const WorldObject& object : m_objects)
     {
-        sf::FloatRect objBounds = object->getBounds();
+        const sf::FloatRect objBounds = object.getBounds();
 
         // Frustum culling
-        if (viewBounds.findIntersection(objBounds).has_value())
-        {
-            object->render(target);
-            ++rendered;
-        }
+        if (!viewBounds.findIntersection(objBounds).has_value())
+            continue;
+
+        const ObjectDefinition* def = getDefinition(object.getType());
+        if (!def)
+            continue;
+
+        const sf::Vector2f topLeft = objBounds.position;
+        const sf::Vector2f bottomRight = objBounds.position + objBounds.size;
+        const sf::Vector2f texTopLeft(sf::Vector2i(def->textureRect.position));
+        const sf::Vector2f texBottomRight(sf::Vector2i(def->textureRect.position + def->textureRect.size));
+
+        // Two triangles, same winding as the map tiles
+        m_batchVertices.append(sf::Vertex({ topLeft, sf::Color::White, texTopLeft }));
+        m_batchVertices.append(sf::Vertex({ sf::Vector2f(bottomRight.x, topLeft.y), sf::Color::White, sf::Vector2f(texBottomRight.x, texTopLeft.y) }));
+        m_batchVertices.append(sf::Vertex({ sf::Vector2f(topLeft.x, bottomRight.y), sf::Color::White, sf::Vector2f(texTopLeft.x, texBottomRight.y) }));
+
+        m_batchVertices.append(sf::Vertex({ sf::Vector2f(bottomRight.x, topLeft.y), sf::Color::White, sf::Vector2f(texBottomRight.x, texTopLeft.y) }));
+        m_batchVertices.append(sf::Vertex({ bottomRight, sf::Color::White, texBottomRight }));
+        m_batchVertices.append(sf::Vertex({ sf::Vector2f(topLeft.x, bottomRight.y), sf::Color::White, sf::Vector2f(texTopLeft.x, texBottomRight.y) }));
     }
+
+    // Whole forest in one draw call
+    if (m_batchVertices.getVertexCount() > 0)
+        target.draw(m_batchVertices, &m_sharedAtlasTexture);
 }
 
 void ObjectPlacer::renderDebug(sf::RenderTarget& target, const sf::View& view) const
@@ -272,7 +466,7 @@ void ObjectPlacer::renderDebug(sf::RenderTarget& target, const sf::View& view) c
     {
         sf::CircleShape circle(8.f);
         circle.setOrigin(sf::Vector2f(8.f, 8.f));
-        circle.setPosition(object->getPosition());
+        circle.setPosition(object.getPosition());
         circle.setFillColor(sf::Color(255, 165, 0, 150));  // Orange, semi-transparent
         circle.setOutlineColor(sf::Color::White);
         circle.setOutlineThickness(1.f);
@@ -280,38 +474,26 @@ void ObjectPlacer::renderDebug(sf::RenderTarget& target, const sf::View& view) c
     }
 }
 
-bool ObjectPlacer::isValidPlacement(const sf::Vector2f& worldPos, Map* map, const PlacementSettings& settings) const
+bool ObjectPlacer::isValidPlacement(const sf::Vector2f& worldPos, const Map* map, MapTile::TerrainType& outTerrain) const
 {
     // Get tile at this position
     const MapTile* tile = map->getTileAtWorldPos(worldPos);
     if (!tile)
         return false;
 
-    // Check if in POI area
-    if (settings.respectPOIs && map->isInsidePOI(worldPos))
-        return false;
-
-    // Check terrain type
-    if (settings.grassOnly)
-    {
-        MapTile::TerrainType terrain = tile->getTerrainType();
-        if (terrain != MapTile::TerrainType::Grass)
-            return false;
-    }
+    // POI areas come from the occupancy layer, terrain is checked per layer, see generateObjects
 
     // Check if tile is walkable (don't place on walls, water, etc.)
     if (!tile->isWalkable())
         return false;
 
+    outTerrain = tile->getTerrainType();
     return true;
 }
 
 const ObjectPlacer::ObjectDefinition* ObjectPlacer::getDefinition(WorldObject::Type type) const
 {
-    auto it = m_definitions.find(type);
-    if (it != m_definitions.end())
-        return &it->second;
-    return nullptr;
+    return m_definitions.find(type);
 }
 
 // ========================================================================================================
@@ -320,14 +502,15 @@ const ObjectPlacer::ObjectDefinition* ObjectPlacer::getDefinition(WorldObject::T
 /*
  * PERLIN NOISE OBJECT PLACEMENT STRATEGY:
  *
- * 1. Sample Grid:
- *    - Check every 2nd tile (sampleStep = 2) for performance
- *    - Can adjust based on object density needs
+ * 1. Sample Points:
+ *    - Poisson disk samples instead of every 2nd tile (was sampleStep = 2)
+ *    - spacing = gap in dense clumps, maxSpacing = gap in open ground
  *
  * 2. Noise Evaluation:
- *    - Calculate noise at tile center position
+ *    - Calculate noise at each candidate position
  *    - Multiply by frequency to control pattern size
  *    - Use octaves for detail variation
+ *    - Noise above the threshold also drives the Poisson spacing (denser at the peaks)
  *
  * 3. Threshold Check:
  *    - Only place object if noise > threshold
@@ -358,7 +541,7 @@ const ObjectPlacer::ObjectDefinition* ObjectPlacer::getDefinition(WorldObject::T
  *
  * PERFORMANCE CONSIDERATIONS:
  *
- * - sampleStep reduces tiles checked (step=2 means 75% reduction)
+ * - Poisson spacing caps the candidates, open ground is sampled at maxSpacing
  * - Octave noise takes ~2-4x longer than single noise
  * - Frustum culling prevents rendering off-screen objects
  * - All objects share same texture atlas (single texture bind)
@@ -369,5 +552,5 @@ const ObjectPlacer::ObjectDefinition* ObjectPlacer::getDefinition(WorldObject::T
  * - Poisson disc sampling (more even distribution)
  * - Voronoi-based placement (one object per region)
  * - Jittered grid (regular with random offset)
- * - Hybrid: Perlin for density, Poisson for exact positions
+ * - Hybrid: Perlin for density, Poisson for exact positions (IN USE, PoissonSampler)
  */
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include <iostream>
 #include <tmxlite/ObjectGroup.hpp>
 #include "WorldObjectTemplate.h"
+#include "CollisionTemplateCache.h"
+#include "Logger.h"
 
 POITemplateManager::POITemplateManager()
 {
@@ -15,6 +17,21 @@ POITemplateManager::POITemplateManager()
 /// </summary>
 bool POITemplateManager::loadTemplate(const std::string& name, const std::string& tmxPath)
 {
+    // Binary cache first, only falls through to the XML when it's missing or older than the .tmx
+    std::vector<CollisionTemplateCache::Group> cached;
+    if (CollisionTemplateCache::load(tmxPath, cached) && !cached.empty())
+    {
+        POITemplate tmpl;
+        tmpl.name = name;
+        tmpl.size = cached[0].size;
+        tmpl.shapes = std::move(cached[0].shapes);
+        m_templates[name] = std::move(tmpl);
+
+        LOG_DEBUG(Core, "Loaded POI template '%s' from cache with %zu collision shapes",
+            name.c_str(), m_templates[name].shapes.size());
+        return true;
+    }
+
     // Creat the tmx map object
     tmx::Map mapData;
     if (!mapData.load(tmxPath))
@@ -27,11 +44,18 @@ bool POITemplateManager::loadTemplate(const std::string& name, const std::string
     POITemplate tmpl = parseTemplate(mapData);
     tmpl.name = name;
 
+    // Write the cache for next time, a failed write just means parsing again
+    CollisionTemplateCache::Group group;
+    group.name = name;
+    group.size = tmpl.size;
+    group.shapes = tmpl.shapes;
+    CollisionTemplateCache::save(tmxPath, { group });
+
     // Store
     m_templates[name] = std::move(tmpl);
 
-    std::cout << "Loaded POI template '" << name << "' with "
-        << m_templates[name].shapes.size() << " collision rects\n";
+    LOG_DEBUG(Core, "Loaded POI template '%s' with %zu collision shapes",
+        name.c_str(), m_templates[name].shapes.size());
 
     return true;
 }
@@ -51,7 +75,7 @@ bool POITemplateManager::hasTemplate(const std::string& name) const
 }
 
 // Apply the collision to the POI
-void POITemplateManager::applyTemplateCollision(PointOfInterest* poi, const std::string& templateName)
+void POITemplateManager::applyTemplateCollision(PointOfInterest* poi, const std::string& templateName) const
 {
     const POITemplate* tmpl = getTemplate(templateName);
     if (!tmpl)
@@ -90,17 +114,14 @@ void POITemplateManager::applyTemplateCollision(PointOfInterest* poi, const std:
                 }
                 else if constexpr (std::is_same_v<T, CollisionPolygon>)
                 {
-                    CollisionPolygon worldPoly;
-                    worldPoly.points.reserve(s.points.size());
-                    for (const auto& pt : s.points)
-                        worldPoly.points.emplace_back(origin.x + pt.x, origin.y + pt.y);
+                    CollisionPolygon worldPoly = s;
+                    worldPoly.translate(origin);
                     poi->addCollisionShape(std::move(worldPoly));
                 }
             }, shape);
     }
 
-    std::cout << "Applied " << tmpl->shapes.size()
-        << " collision rects to '" << poi->getName() << "'\n";
+    LOG_TRACE(Core, "Applied %zu collision shapes to '%s'", tmpl->shapes.size(), poi->getName().c_str());
 }
 
 POITemplate POITemplateManager::parseTemplate(const tmx::Map& mapData)
@@ -160,7 +181,10 @@ std::vector<CollisionShape> POITemplateManager::extractCollisionShapes(const tmx
                     poly.points.emplace_back(ox + pt.x, oy + pt.y);
                 }
                 if (poly.points.size() >= 3)
+                {
+                    poly.computeBounds();
                     shapes.emplace_back(std::move(poly));
+                }
                 break;
             }
             default:
@@ -176,4 +200,4 @@ std::vector<CollisionShape> POITemplateManager::extractCollisionShapes(const tmx
 // Example
 /*
 To be done
-*/
\ No newline at end of file
+*/
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include "Logger.h"
 
 POIConfigRegistry::POIConfigRegistry()
 {
@@ -17,17 +18,14 @@ void POIConfigRegistry::registerPOIType(PointOfInterest::Type type, const POITyp
 
 const POITypeConfig* POIConfigRegistry::getConfig(PointOfInterest::Type type) const
 {
-    // Get it and fnd it
-    auto it = m_configs.find(type);
-    if (it != m_configs.end())
-        return &it->second;
-    return nullptr;
+    // Straight index, nullptr for types with no config yet (Landmark, Quarry)
+    return m_configs.find(type);
 }
 
 bool POIConfigRegistry::hasConfig(PointOfInterest::Type type) const
 {
     // Checker
-    return m_configs.find(type) != m_configs.end();
+    return m_configs.contains(type);
 }
 
 // This is to provide a config for the POI template later. 
@@ -62,13 +60,12 @@ void POIConfigRegistry::loadDefaultConfigs()
 
     // This to try and auto size the tile areas needed based ont he above sizes. 
     // Found it annoying doing it each time and hopefully make implementation easier sob
-    for (auto& [type, config] : m_configs)
+    for (auto [type, config] : m_configs)
     {
         if (config.autoSizeFromSprite && !config.definitionsPath.empty())
         {
             config.size = parseSizeFromDefinition(config.definitionsPath);
-            std::cout << "Auto-sized " << config.name << ": "
-                << config.size.x << "x" << config.size.y << "\n";
+            LOG_DEBUG(MapGen, "Auto-sized %s: %.0fx%.0f", config.name.c_str(), config.size.x, config.size.y);
         }
     }
 }
@@ -2,6 +2,7 @@
 #include "InputController.h"
 #include "MathUtilities.h"
 #include "AssetPaths.h"
+#include "Logger.h"
 
 #define _USE_MATH_DEFINES
 #include <math.h>
@@ -147,23 +148,22 @@ void Player::renderInventory(sf::RenderTarget& target) const
 void Player::equipWeapon(ItemType type)
 {
     m_equippedWeapon = type;
-    std::cout << "Weapon equipped: " << static_cast<int>(type) << "\n";
+    LOG_DEBUG(Player, "Weapon equipped: %d", static_cast<int>(type));
 }
 
 float Player::attack(const sf::Vector2f& targetWorldPos)
 {
     if (m_equippedWeapon == ItemType::COUNT)
     {
-        std::cout << "No weapon equipped\n";
+        LOG_DEBUG(Player, "No weapon equipped");
         return 0.f;
     }
 
-    static const float damageTable[] = { 0.f, 0.f, 0.f, 0.f, 0.f, 25.f, 50.f, 75.f };
-    // Index matches ItemType enum order: Food=0,Water=1,FirstAid=2,Bandage=3,Knife=4,Axe=5,Gun=6
+    // PN: Had a local damage table here that was off by one (knife did the axe's damage), ITEM_STATS is the only copy now
     int idx = static_cast<int>(m_equippedWeapon);
-    float dmg = (idx >= 0 && idx < 8) ? damageTable[idx] : 0.f;
+    float dmg = getItemDamage(m_equippedWeapon);
 
-    std::cout << "Attack with weapon " << idx << " for " << dmg << " damage\n";
+    LOG_DEBUG(Player, "Attack with weapon %d for %.1f damage", idx, dmg);
     return dmg;
 }
 
@@ -229,16 +229,16 @@ void Player::changeState(PlayerState newState)
     switch (m_currentState)
     {
     case PlayerState::Idle:
-        std::cout << "State: IDLE\n";
+        LOG_TRACE(Player, "State: IDLE");
         break;
     case PlayerState::Walk:
-        std::cout << "State: WALK\n";
+        LOG_TRACE(Player, "State: WALK");
         break;
     case PlayerState::Sprint:
-        std::cout << "State: SPRINT\n";
+        LOG_TRACE(Player, "State: SPRINT");
         break;
     case PlayerState::InventoryOpen:
-        std::cout << "State: INVENTORY OPEN\n";
+        LOG_TRACE(Player, "State: INVENTORY OPEN");
     }
 }
 
@@ -359,19 +359,19 @@ void Player::onItemUsed(ItemType type)
     {
     case ItemType::Food:
         m_hunger.increase(30.f);
-        std::cout << "Ate food. Hunger: " << m_hunger.getValue() << "\n";
+        LOG_INFO(Player, "Ate food. Hunger: %.1f", m_hunger.getValue());
         break;
     case ItemType::Water:
         m_water.increase(40.f);
-        std::cout << "Drank water. Water: " << m_water.getValue() << "\n";
+        LOG_INFO(Player, "Drank water. Water: %.1f", m_water.getValue());
         break;
     case ItemType::FirstAid:
         m_health.heal(100.f);
-        std::cout << "Used First Aid. HP: " << m_health.getCurrentHealth() << "\n";
+        LOG_INFO(Player, "Used First Aid. HP: %.1f", m_health.getCurrentHealth());
         break;
     case ItemType::Bandage:
         m_health.heal(35.f);
-        std::cout << "Used Bandage. HP: " << m_health.getCurrentHealth() << "\n";
+        LOG_INFO(Player, "Used Bandage. HP: %.1f", m_health.getCurrentHealth());
         break;
     case ItemType::Knife:
         equipWeapon(type);
@@ -379,7 +379,7 @@ void Player::onItemUsed(ItemType type)
         equipWeapon(type);
     case ItemType::Gun:
         equipWeapon(type);
-        std::cout << "Equipped weapon (type " << static_cast<int>(type) << ")\n";
+        LOG_INFO(Player, "Equipped weapon (type %d)", static_cast<int>(type));
         break;
     default:
         break;
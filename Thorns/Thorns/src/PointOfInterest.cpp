@@ -1,6 +1,7 @@
 #include "PointOfInterest.h"
 #include "CollisionManager.h"
 #include <iostream>
+#include "Logger.h"
 
 PointOfInterest::PointOfInterest(const std::string& name, Type type,
     const sf::Vector2f& worldPos, const sf::Vector2f& size)
@@ -40,7 +41,7 @@ bool PointOfInterest::loadSprite(const std::string& spritePath)
     m_sprite->centerOrigin();
     m_sprite->setPosition(m_worldPosition);
 
-    std::cout << "Loaded POI sprite: " << m_name << " (" << m_size.x << "x" << m_size.y << ")\n";
+    LOG_DEBUG(MapGen, "Loaded POI sprite: %s (%.0fx%.0f)", m_name.c_str(), m_size.x, m_size.y);
     return true;
 }
 
@@ -72,8 +73,7 @@ void PointOfInterest::setPosition(const sf::Vector2f& pos)
                 }
                 else if constexpr (std::is_same_v<T, CollisionPolygon>)
                 {
-                    for (auto& pt : s.points)
-                        pt += offset;
+                    s.translate(offset);
                 }
             }, shape);
     }
@@ -121,7 +121,8 @@ bool PointOfInterest::checkEntityCollision(const sf::FloatRect& entityBounds) co
                 if constexpr (std::is_same_v<T, sf::FloatRect>)
                     return entityBounds.findIntersection(s).has_value();
                 else if constexpr (std::is_same_v<T, CollisionPolygon>)
-                    return CollisionManager::aabbVsPolygon(entityBounds, s.points);
+                    return entityBounds.findIntersection(s.bounds).has_value()
+                        && CollisionManager::aabbVsPolygon(entityBounds, s.points);
                 return false;
             }, shape);
 
@@ -166,18 +167,8 @@ std::vector<sf::FloatRect> PointOfInterest::getCollisionRects() const
                 }
                 else if constexpr (std::is_same_v<T, CollisionPolygon>)
                 {
-                    // AABB of polygon for tile marking
-                    float minX = s.points[0].x, maxX = s.points[0].x;
-                    float minY = s.points[0].y, maxY = s.points[0].y;
-                    for (const auto& pt : s.points)
-                    {
-                        minX = std::min(minX, pt.x); maxX = std::max(maxX, pt.x);
-                        minY = std::min(minY, pt.y); maxY = std::max(maxY, pt.y);
-                    }
-                    rects.emplace_back(
-                        sf::Vector2f(minX, minY),
-                        sf::Vector2f(maxX - minX, maxY - minY)
-                    );
+                    // AABB of polygon for tile marking, precomputed when the template loaded
+                    rects.push_back(s.bounds);
                 }
             }, shape);
     }
@@ -188,4 +179,4 @@ std::vector<sf::FloatRect> PointOfInterest::getCollisionRects() const
 bool PointOfInterest::hasSprite() const
 {
     return m_sprite && m_sprite->isValid();
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,333 @@
+#include "PoissonSampler.h"
+#include "MathUtilities.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+PoissonSampler::PoissonSampler()
+    : m_origin(0.f, 0.f)
+    , m_cellSize(1.f)
+    , m_gridWidth(0)
+    , m_gridHeight(0)
+    , m_searchCells(2)
+    , m_maxRadius(1.f)
+    , m_exploreCellSize(1.f)
+    , m_exploreGridWidth(0)
+    , m_exploreGridHeight(0)
+{
+}
+
+// ========================================================================================================
+// EXCLUSIONS
+// ========================================================================================================
+void PoissonSampler::clearExclusions()
+{
+    m_circles.clear();
+    m_rects.clear();
+    m_polygons.clear();
+}
+
+void PoissonSampler::addExclusionCircle(const sf::Vector2f& centre, float radius)
+{
+    m_circles.push_back({ centre, radius * radius });
+}
+
+void PoissonSampler::addExclusionRect(const sf::FloatRect& rect)
+{
+    m_rects.push_back(rect);
+}
+
+void PoissonSampler::addExclusionPolygon(const CollisionPolygon& polygon)
+{
+    if (polygon.points.size() < 3)
+        return;
+
+    m_polygons.push_back(polygon);
+    m_polygons.back().computeBounds();
+}
+
+bool PoissonSampler::isExcluded(const sf::Vector2f& pos) const
+{
+    for (const ExclusionCircle& circle : m_circles)
+    {
+        const sf::Vector2f d = pos - circle.centre;
+        if (d.x * d.x + d.y * d.y < circle.radiusSq)
+            return true;
+    }
+
+    for (const sf::FloatRect& rect : m_rects)
+    {
+        if (rect.contains(pos))
+            return true;
+    }
+
+    for (const CollisionPolygon& polygon : m_polygons)
+    {
+        if (polygon.bounds.contains(pos) && polygonContains(polygon, pos))
+            return true;
+    }
+
+    return false;
+}
+
+bool PoissonSampler::polygonContains(const CollisionPolygon& polygon, const sf::Vector2f& pos)
+{
+    // Even-odd ray cast to the right, works for concave outlines too
+    bool inside = false;
+    const size_t count = polygon.points.size();
+    for (size_t i = 0, j = count - 1; i < count; j = i++)
+    {
+        const sf::Vector2f& a = polygon.points[i];
+        const sf::Vector2f& b = polygon.points[j];
+        if ((a.y > pos.y) != (b.y > pos.y)
+            && pos.x < (b.x - a.x) * (pos.y - a.y) / (b.y - a.y) + a.x)
+        {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+// ========================================================================================================
+// SAMPLING
+// ========================================================================================================
+size_t PoissonSampler::sample(const Params& params, std::mt19937& rng, PointList& out,
+    const DensityFunction& density, const AcceptFunction& accept)
+{
+    PROFILE_ZONE("PoissonSampler::sample");
+
+    out.clear();
+
+    if (params.minRadius <= 0.f || params.bounds.size.x <= 0.f || params.bounds.size.y <= 0.f)
+        return 0;
+
+    // Same resource as the output, an arena backed caller gets a sample() that never hits the heap
+    Scratch scratch(out.get_allocator().resource());
+
+    const float maxRadius = std::max(params.minRadius, params.maxRadius);
+    const sf::Vector2f boundsMax = params.bounds.position + params.bounds.size;
+
+    // Cell size r / sqrt(2) ensures no two points in same cell
+    m_origin = params.bounds.position;
+    m_cellSize = params.minRadius / std::sqrt(2.f);
+    m_gridWidth = static_cast<int>(std::ceil(params.bounds.size.x / m_cellSize));
+    m_gridHeight = static_cast<int>(std::ceil(params.bounds.size.y / m_cellSize));
+    m_searchCells = static_cast<int>(std::ceil(maxRadius / m_cellSize));
+
+    scratch.grid.assign(static_cast<size_t>(m_gridWidth) * m_gridHeight, -1);
+
+    // Explore points are all maxRadius apart, a grid that coarse needs no bigger search than Bridson's
+    if (accept)
+    {
+        m_maxRadius = maxRadius;
+        m_exploreCellSize = maxRadius / std::sqrt(2.f);
+        m_exploreGridWidth = static_cast<int>(std::ceil(params.bounds.size.x / m_exploreCellSize));
+        m_exploreGridHeight = static_cast<int>(std::ceil(params.bounds.size.y / m_exploreCellSize));
+        scratch.exploreGrid.assign(static_cast<size_t>(m_exploreGridWidth) * m_exploreGridHeight, -1);
+    }
+    if (params.maxPoints > 0)
+    {
+        // Known upper bound on the output, no regrowth (a monotonic arena never gets the old
+        // blocks back). Explore points aren't counted, at maxRadius spacing there are few of them
+        out.reserve(params.maxPoints);
+        scratch.radii.reserve(params.maxPoints);
+        scratch.activeList.reserve(params.maxPoints);
+    }
+
+    std::uniform_real_distribution<float> distX(params.bounds.position.x, boundsMax.x);
+    std::uniform_real_distribution<float> distY(params.bounds.position.y, boundsMax.y);
+    std::uniform_real_distribution<float> distAngle(0.f, MathUtils::TWO_PI);
+
+    // Initial sample, anywhere that isn't excluded. Accepted or not it seeds the growth
+    sf::Vector2f initialSample;
+    bool foundInitial = false;
+    for (int attempt = 0; attempt < 1000 && !foundInitial; ++attempt)
+    {
+        initialSample = sf::Vector2f(distX(rng), distY(rng));
+        foundInitial = !isExcluded(initialSample);
+    }
+
+    if (!foundInitial)
+        return 0;
+
+    // Same call order as the main loop, density always runs before accept
+    const float initialRadius = radiusAt(initialSample, params, density);
+    if (!accept || accept(initialSample))
+        insert(initialSample, initialRadius, scratch, out);
+    else
+        insertExplore(initialSample, scratch);
+
+    while (!scratch.activeList.empty() && (params.maxPoints == 0 || out.size() < params.maxPoints))
+    {
+        // Pick random point from active list
+        std::uniform_int_distribution<size_t> activeDist(0, scratch.activeList.size() - 1);
+        const size_t activeIndex = activeDist(rng);
+        const int activePoint = scratch.activeList[activeIndex];
+        const bool isExplore = activePoint < 0;
+        const sf::Vector2f activePos = isExplore ? scratch.explorePoints[~activePoint] : out[activePoint];
+        const float activeRadius = isExplore ? maxRadius : scratch.radii[activePoint];
+
+        // Annulus between r and 2r of the active point, r being its own spacing
+        std::uniform_real_distribution<float> distRadius(activeRadius, 2.f * activeRadius);
+
+        bool foundValidPoint = false;
+        for (int attempt = 0; attempt < params.attemptsPerPoint; ++attempt)
+        {
+            const float radius = distRadius(rng);
+            const float angle = distAngle(rng);
+            const sf::Vector2f candidate = activePos + MathUtils::angleRadiansToVector(angle) * radius;
+
+            if (candidate.x < params.bounds.position.x || candidate.x >= boundsMax.x ||
+                candidate.y < params.bounds.position.y || candidate.y >= boundsMax.y)
+                continue;
+
+            if (isExcluded(candidate))
+                continue;
+
+            const float candidateRadius = radiusAt(candidate, params, density);
+            if (isFarEnough(candidate, candidateRadius, scratch, out) && (!accept || accept(candidate)))
+            {
+                insert(candidate, candidateRadius, scratch, out);
+                foundValidPoint = true;
+                break;
+            }
+
+            // Not a sample (too close or turned down), but it can still be a stepping stone so
+            // the walk gets across ground accept turns down to the next area it takes
+            if (accept && isFarFromExplore(candidate, scratch))
+            {
+                insertExplore(candidate, scratch);
+                foundValidPoint = true;
+                break;
+            }
+        }
+
+        // No room left around this point, swap with the last and pop. The list is picked from at
+        // random anyway so order doesn't matter, only the layout a seed gives (GENERATOR_VERSION 4)
+        if (!foundValidPoint)
+        {
+            scratch.activeList[activeIndex] = scratch.activeList.back();
+            scratch.activeList.pop_back();
+        }
+    }
+
+    return out.size();
+}
+
+float PoissonSampler::radiusAt(const sf::Vector2f& pos, const Params& params, const DensityFunction& density) const
+{
+    if (!density)
+        return params.minRadius;
+
+    // Called even when the radius can't vary, accept may rely on what density worked out
+    const float t = std::clamp(density(pos), 0.f, 1.f);
+    if (params.maxRadius <= params.minRadius)
+        return params.minRadius;
+    return params.maxRadius + (params.minRadius - params.maxRadius) * t;
+}
+
+bool PoissonSampler::isFarEnough(const sf::Vector2f& pos, float radius, const Scratch& scratch,
+    const PointList& points) const
+{
+    const int cellX = static_cast<int>((pos.x - m_origin.x) / m_cellSize);
+    const int cellY = static_cast<int>((pos.y - m_origin.y) / m_cellSize);
+
+    const int minX = std::max(0, cellX - m_searchCells);
+    const int maxX = std::min(m_gridWidth - 1, cellX + m_searchCells);
+    const int minY = std::max(0, cellY - m_searchCells);
+    const int maxY = std::min(m_gridHeight - 1, cellY + m_searchCells);
+
+    for (int y = minY; y <= maxY; ++y)
+    {
+        for (int x = minX; x <= maxX; ++x)
+        {
+            const int neighbour = scratch.grid[y * m_gridWidth + x];
+            if (neighbour < 0)
+                continue;
+
+            // Both points get their own spacing, the larger one wins
+            const float spacing = std::max(radius, scratch.radii[neighbour]);
+            const sf::Vector2f d = pos - points[neighbour];
+            if (d.x * d.x + d.y * d.y < spacing * spacing)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+void PoissonSampler::insert(const sf::Vector2f& pos, float radius, Scratch& scratch, PointList& points)
+{
+    const int index = static_cast<int>(points.size());
+    points.push_back(pos);
+    scratch.radii.push_back(radius);
+    scratch.activeList.push_back(index);
+
+    const int cellX = std::min(static_cast<int>((pos.x - m_origin.x) / m_cellSize), m_gridWidth - 1);
+    const int cellY = std::min(static_cast<int>((pos.y - m_origin.y) / m_cellSize), m_gridHeight - 1);
+    scratch.grid[cellY * m_gridWidth + cellX] = index;
+}
+
+int PoissonSampler::exploreCellIndex(const sf::Vector2f& pos) const
+{
+    const int cellX = std::min(static_cast<int>((pos.x - m_origin.x) / m_exploreCellSize), m_exploreGridWidth - 1);
+    const int cellY = std::min(static_cast<int>((pos.y - m_origin.y) / m_exploreCellSize), m_exploreGridHeight - 1);
+    return cellY * m_exploreGridWidth + cellX;
+}
+
+bool PoissonSampler::isFarFromExplore(const sf::Vector2f& pos, const Scratch& scratch) const
+{
+    const int cell = exploreCellIndex(pos);
+    const int cellX = cell % m_exploreGridWidth;
+    const int cellY = cell / m_exploreGridWidth;
+
+    for (int y = std::max(0, cellY - 2); y <= std::min(m_exploreGridHeight - 1, cellY + 2); ++y)
+    {
+        for (int x = std::max(0, cellX - 2); x <= std::min(m_exploreGridWidth - 1, cellX + 2); ++x)
+        {
+            const int neighbour = scratch.exploreGrid[y * m_exploreGridWidth + x];
+            if (neighbour < 0)
+                continue;
+
+            const sf::Vector2f d = pos - scratch.explorePoints[neighbour];
+            if (d.x * d.x + d.y * d.y < m_maxRadius * m_maxRadius)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+void PoissonSampler::insertExplore(const sf::Vector2f& pos, Scratch& scratch)
+{
+    // Negative in the active list, ~ keeps explore point 0 apart from sample 0
+    const int index = static_cast<int>(scratch.explorePoints.size());
+    scratch.explorePoints.push_back(pos);
+    scratch.activeList.push_back(~index);
+    scratch.exploreGrid[exploreCellIndex(pos)] = index;
+}
+
+// Personal Notes Poisson Sampler:
+/*
+    Started as VoronoiDiagram::generateSitesPoisson, pulled out so objects and spawns could use it.
+    Reference: https://www.cs.ubc.ca/~rbridson/docs/bridson-siggraph07-poissondisk.pdf
+
+    Variable radius:
+    - Grid is sized for the smallest spacing so the one-point-per-cell rule still holds
+    - Search window grows to cover the largest spacing (maxRadius / cellSize cells each way)
+    - Two points must be max(rA, rB) apart, so a dense point can't creep into a sparse one's disk
+
+    Density + threshold (object placement):
+    - Perlin gives the density, so clumps pack tight and open ground stays sparse
+    - Below the threshold the radius is at its max, few wasted candidates in empty areas
+
+    Accept is a filter, not a growth gate:
+    - Growth used to only come from accepted points, so it was a flood fill from the first one.
+      A grass only layer stopped at the first patch of dirt wider than the 2 * maxRadius jump
+    - Candidates that don't become samples go in an explore set and still spawn neighbours.
+      Spaced at maxRadius, so their step (up to 2 * maxRadius) crosses any gap and there are
+      only ever a few of them (coarse grid, 5x5 search instead of the fine grid's window)
+    - The two sets never check each other. Spacing explore points against samples left them
+      stuck at a clump's edge (its small step can't clear maxRadius), and the other way round
+      a stepping stone next to a clump punched a hole in it
+*/
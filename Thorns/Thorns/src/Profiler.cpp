@@ -0,0 +1,306 @@
+#include "Profiler.h"
+#include "Logger.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// INTERNAL STATE
+// ============================================================================
+namespace
+{
+    struct ZoneSlot
+    {
+        const char* name = "";
+        std::atomic<long long> frameNs{ 0 };     // Accumulated this frame
+        std::atomic<int> frameCalls{ 0 };
+        std::array<float, Profiler::HISTORY_FRAMES> historyMs{};
+        int lastCalls = 0;
+    };
+
+    struct TraceEvent
+    {
+        Profiler::ZoneId zone;
+        long long startNs;
+        long long durationNs;
+        unsigned int threadId;
+    };
+
+    struct ProfilerState
+    {
+        std::array<ZoneSlot, Profiler::MAX_ZONES> zones;
+        std::atomic<int> zoneCount{ 0 };
+        std::mutex registerMutex;
+
+        // Frame history, written at endFrame()
+        std::array<float, Profiler::HISTORY_FRAMES> frameHistoryMs{};
+        int historyHead = -1;
+        int framesRecorded = 0;
+        long long frameStartNs = 0;
+
+        // Chrome trace capture
+        std::atomic<bool> capturing{ false };
+        std::mutex captureMutex;
+        std::vector<TraceEvent> captureEvents;
+        int captureFramesLeft = 0;
+        std::string capturePath;
+
+        const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    };
+
+    ProfilerState& state()
+    {
+        static ProfilerState s;
+        return s;
+    }
+
+    // Small stable id per thread for the trace viewer rows
+    unsigned int currentThreadId()
+    {
+        return static_cast<unsigned int>(std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xFFFF);
+    }
+
+    // Escapes the few characters that can show up in zone names
+    void writeJsonString(std::ofstream& out, const char* text)
+    {
+        out << '"';
+        for (const char* c = text; *c; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+                out << '\\';
+            out << *c;
+        }
+        out << '"';
+    }
+
+    bool writeChromeTrace(const std::string& filePath, const std::vector<TraceEvent>& events)
+    {
+        std::ofstream out(filePath, std::ios::out | std::ios::trunc);
+        if (!out.is_open())
+            return false;
+
+        ProfilerState& s = state();
+
+        // Microseconds with the nanoseconds kept, the default precision goes to 1.23457e+06 past a second
+        out << std::fixed << std::setprecision(3);
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        for (size_t i = 0; i < events.size(); ++i)
+        {
+            const TraceEvent& e = events[i];
+
+            // Complete ("X") events, timestamps are in microseconds
+            out << "{\"name\":";
+            writeJsonString(out, s.zones[e.zone].name);
+            out << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":0,\"tid\":" << e.threadId
+                << ",\"ts\":" << (e.startNs / 1000.0)
+                << ",\"dur\":" << (e.durationNs / 1000.0) << "}";
+
+            if (i + 1 < events.size())
+                out << ",";
+            out << "\n";
+        }
+        out << "]}\n";
+
+        return true;
+    }
+
+    Profiler::ZoneId frameZone()
+    {
+        static const Profiler::ZoneId id = Profiler::registerZone("Frame");
+        return id;
+    }
+}
+
+// ============================================================================
+// ZONES
+// ============================================================================
+Profiler::ZoneId Profiler::registerZone(const char* name)
+{
+    ProfilerState& s = state();
+    std::lock_guard<std::mutex> lock(s.registerMutex);
+
+    int count = s.zoneCount.load(std::memory_order_relaxed);
+
+    // Same literal can be registered from two sites (e.g. a header), share the slot
+    for (int i = 0; i < count; ++i)
+    {
+        if (std::strcmp(s.zones[i].name, name) == 0)
+            return i;
+    }
+
+    if (count >= MAX_ZONES)
+    {
+        LOG_WARN(Core, "Profiler: MAX_ZONES reached, '%s' will share the last slot", name);
+        return MAX_ZONES - 1;
+    }
+
+    s.zones[count].name = name;
+    s.zoneCount.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+long long Profiler::nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - state().epoch).count();
+}
+
+void Profiler::recordZone(ZoneId id, long long startNs, long long endNs)
+{
+    ProfilerState& s = state();
+    ZoneSlot& zone = s.zones[id];
+
+    zone.frameNs.fetch_add(endNs - startNs, std::memory_order_relaxed);
+    zone.frameCalls.fetch_add(1, std::memory_order_relaxed);
+
+    if (s.capturing.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(s.captureMutex);
+        if (s.captureEvents.size() < static_cast<size_t>(MAX_CAPTURE_EVENTS))
+            s.captureEvents.push_back({ id, startNs, endNs - startNs, currentThreadId() });
+    }
+}
+
+// ============================================================================
+// FRAME
+// ============================================================================
+void Profiler::beginFrame()
+{
+    frameZone();
+    state().frameStartNs = nowNs();
+}
+
+void Profiler::endFrame()
+{
+    ProfilerState& s = state();
+    const long long endNs = nowNs();
+
+    // Whole frame is recorded as its own zone so it shows up in the trace too
+    recordZone(frameZone(), s.frameStartNs, endNs);
+
+    s.historyHead = (s.historyHead + 1) % HISTORY_FRAMES;
+    s.frameHistoryMs[s.historyHead] = static_cast<float>((endNs - s.frameStartNs) / 1.0e6);
+    if (s.framesRecorded < HISTORY_FRAMES)
+        ++s.framesRecorded;
+
+    // Roll every zone's accumulator into its history
+    const int count = s.zoneCount.load(std::memory_order_acquire);
+    for (int i = 0; i < count; ++i)
+    {
+        ZoneSlot& zone = s.zones[i];
+        long long ns = zone.frameNs.exchange(0, std::memory_order_relaxed);
+        zone.lastCalls = zone.frameCalls.exchange(0, std::memory_order_relaxed);
+        zone.historyMs[s.historyHead] = static_cast<float>(ns / 1.0e6);
+    }
+
+    // Finish the capture once enough frames have gone by
+    if (s.capturing.load(std::memory_order_relaxed) && --s.captureFramesLeft <= 0)
+    {
+        s.capturing.store(false, std::memory_order_relaxed);
+
+        std::vector<TraceEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(s.captureMutex);
+            events.swap(s.captureEvents);
+        }
+
+        if (writeChromeTrace(s.capturePath, events))
+            LOG_INFO(Core, "Profiler: Wrote %zu trace events to %s", events.size(), s.capturePath.c_str());
+        else
+            LOG_ERROR(Core, "Profiler: Failed to write trace file %s", s.capturePath.c_str());
+    }
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+int Profiler::getZoneCount()
+{
+    return state().zoneCount.load(std::memory_order_acquire);
+}
+
+Profiler::ZoneStats Profiler::getZoneStats(ZoneId id)
+{
+    ProfilerState& s = state();
+    ZoneStats stats;
+
+    if (id < 0 || id >= getZoneCount())
+        return stats;
+
+    const ZoneSlot& zone = s.zones[id];
+    stats.name = zone.name;
+    stats.lastCalls = zone.lastCalls;
+
+    if (s.framesRecorded == 0)
+        return stats;
+
+    stats.lastMs = zone.historyMs[s.historyHead];
+
+    float total = 0.f;
+    for (int i = 0; i < s.framesRecorded; ++i)
+    {
+        float ms = zone.historyMs[i];
+        total += ms;
+        if (ms > stats.maxMs)
+            stats.maxMs = ms;
+    }
+    stats.avgMs = total / s.framesRecorded;
+
+    return stats;
+}
+
+int Profiler::copyFrameHistory(std::array<float, HISTORY_FRAMES>& out)
+{
+    ProfilerState& s = state();
+    out = s.frameHistoryMs;
+    return s.historyHead;
+}
+
+float Profiler::getAverageFrameMs()
+{
+    ProfilerState& s = state();
+    if (s.framesRecorded == 0)
+        return 0.f;
+
+    float total = 0.f;
+    for (int i = 0; i < s.framesRecorded; ++i)
+        total += s.frameHistoryMs[i];
+
+    return total / s.framesRecorded;
+}
+
+// ============================================================================
+// CHROME TRACE
+// ============================================================================
+bool Profiler::beginCapture(int frameCount, const std::string& filePath)
+{
+    ProfilerState& s = state();
+
+    if (s.capturing.load() || frameCount <= 0)
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(s.captureMutex);
+        s.captureEvents.clear();
+        s.captureEvents.reserve(4096);
+    }
+
+    s.captureFramesLeft = frameCount;
+    s.capturePath = filePath;
+    s.capturing.store(true, std::memory_order_relaxed);
+
+    LOG_INFO(Core, "Profiler: Capturing %d frames to %s", frameCount, filePath.c_str());
+    return true;
+}
+
+bool Profiler::isCapturing()
+{
+    return state().capturing.load(std::memory_order_relaxed);
+}
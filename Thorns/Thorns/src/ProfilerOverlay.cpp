@@ -0,0 +1,135 @@
+#include "ProfilerOverlay.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+ProfilerOverlay::ProfilerOverlay()
+    : m_visible(false)
+    , m_refreshTimer(0.f)
+    , m_fontLoaded(false)
+{
+}
+
+bool ProfilerOverlay::initialize(const std::string& fontPath)
+{
+    if (!m_font.openFromFile(fontPath))
+    {
+        std::cerr << "ProfilerOverlay: Failed to load font: " << fontPath << "\n";
+        return false;
+    }
+
+    m_fontLoaded = true;
+    return true;
+}
+
+void ProfilerOverlay::update(sf::Time deltaTime)
+{
+    if (!m_visible)
+        return;
+
+    m_refreshTimer -= deltaTime.asSeconds();
+    if (m_refreshTimer > 0.f)
+        return;
+
+    m_refreshTimer = REFRESH_INTERVAL;
+    rebuildText();
+}
+
+void ProfilerOverlay::rebuildText()
+{
+    char line[128];
+    const float avgFrame = Profiler::getAverageFrameMs();
+
+    std::snprintf(line, sizeof(line), "FRAME  avg %.2f ms (%.0f fps)%s\n\n",
+        avgFrame,
+        avgFrame > 0.f ? 1000.f / avgFrame : 0.f,
+        Profiler::isCapturing() ? "  [CAPTURING]" : "");
+    m_tableText = line;
+
+    std::snprintf(line, sizeof(line), "%-28s %7s %7s %7s %5s\n", "ZONE", "LAST", "AVG", "MAX", "CALLS");
+    m_tableText += line;
+
+    const int count = Profiler::getZoneCount();
+    for (int i = 0; i < count; ++i)
+    {
+        Profiler::ZoneStats stats = Profiler::getZoneStats(i);
+        std::snprintf(line, sizeof(line), "%-28.28s %7.3f %7.3f %7.3f %5d\n",
+            stats.name, stats.lastMs, stats.avgMs, stats.maxMs, stats.lastCalls);
+        m_tableText += line;
+    }
+}
+
+void ProfilerOverlay::render(sf::RenderTarget& target) const
+{
+    if (!m_visible || !m_fontLoaded)
+        return;
+
+    const int lineCount = static_cast<int>(std::count(m_tableText.begin(), m_tableText.end(), '\n'));
+    const float panelHeight = GRAPH_HEIGHT + 30.f + lineCount * LINE_HEIGHT;
+    const float panelX = PANEL_LEFT_MARGIN;
+    const float panelY = PANEL_TOP_MARGIN;
+
+    // Panel background
+    sf::RectangleShape panel(sf::Vector2f(PANEL_WIDTH, panelHeight));
+    panel.setPosition(sf::Vector2f(panelX, panelY));
+    panel.setFillColor(sf::Color(20, 20, 20, 210));
+    panel.setOutlineThickness(1.f);
+    panel.setOutlineColor(sf::Color(180, 180, 180, 200));
+    target.draw(panel);
+
+    // ========== Frame time graph ==========
+    // One bar per history frame, green under budget, yellow under 2x, red above
+    std::array<float, Profiler::HISTORY_FRAMES> history;
+    const int head = Profiler::copyFrameHistory(history);
+
+    const float graphLeft = panelX + 10.f;
+    const float graphBottom = panelY + 10.f + GRAPH_HEIGHT;
+    const float barWidth = (PANEL_WIDTH - 20.f) / Profiler::HISTORY_FRAMES;
+
+    sf::VertexArray bars(sf::PrimitiveType::Triangles, Profiler::HISTORY_FRAMES * 6);
+    for (int i = 0; i < Profiler::HISTORY_FRAMES; ++i)
+    {
+        // Oldest on the left, newest on the right
+        const int index = (head + 1 + i) % Profiler::HISTORY_FRAMES;
+        const float ms = std::min(history[index], GRAPH_MAX_MS);
+        const float barHeight = (ms / GRAPH_MAX_MS) * GRAPH_HEIGHT;
+
+        sf::Color color = sf::Color(80, 200, 80);
+        if (history[index] > FRAME_BUDGET_MS * 2.f)
+            color = sf::Color(220, 60, 60);
+        else if (history[index] > FRAME_BUDGET_MS)
+            color = sf::Color(230, 200, 60);
+
+        const float left = graphLeft + i * barWidth;
+        const float right = left + barWidth;
+        const float top = graphBottom - barHeight;
+
+        sf::Vertex* quad = &bars[i * 6];
+        quad[0].position = sf::Vector2f(left, top);
+        quad[1].position = sf::Vector2f(right, top);
+        quad[2].position = sf::Vector2f(left, graphBottom);
+        quad[3].position = sf::Vector2f(right, top);
+        quad[4].position = sf::Vector2f(right, graphBottom);
+        quad[5].position = sf::Vector2f(left, graphBottom);
+
+        for (int v = 0; v < 6; ++v)
+            quad[v].color = color;
+    }
+    target.draw(bars);
+
+    // 60fps budget line
+    const float budgetY = graphBottom - (FRAME_BUDGET_MS / GRAPH_MAX_MS) * GRAPH_HEIGHT;
+    sf::RectangleShape budgetLine(sf::Vector2f(PANEL_WIDTH - 20.f, 1.f));
+    budgetLine.setPosition(sf::Vector2f(graphLeft, budgetY));
+    budgetLine.setFillColor(sf::Color(255, 255, 255, 120));
+    target.draw(budgetLine);
+
+    // ========== Zone table ==========
+    sf::Text table(m_font);
+    table.setString(m_tableText);
+    table.setCharacterSize(FONT_SIZE);
+    table.setFillColor(sf::Color(230, 230, 230));
+    table.setPosition(sf::Vector2f(graphLeft, graphBottom + 15.f));
+    target.draw(table);
+}
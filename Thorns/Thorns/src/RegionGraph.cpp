@@ -0,0 +1,309 @@
+#include "RegionGraph.h"
+#include "Map.h"
+#include "Profiler.h"
+#include <algorithm>
+
+RegionGraph::RegionGraph()
+{
+}
+
+// ========================================================================================================
+// BUILDING
+// ========================================================================================================
+void RegionGraph::begin(int regionCount, int bandCount)
+{
+    regionCount = std::max(regionCount, 0);
+    bandCount = std::max(bandCount, 1);
+
+    // Bands are never resized while jobs run, so size them all up front
+    if (static_cast<int>(m_bands.size()) < bandCount)
+        m_bands.resize(bandCount);
+
+    for (Band& band : m_bands)
+    {
+        band.regions.assign(regionCount, Accum());
+        band.borders.clear();
+        band.edges.clear();
+        band.used = false;
+    }
+
+    m_seams.regions.clear();
+    m_seams.borders.clear();
+    m_seams.edges.clear();
+
+    m_regions.assign(regionCount, RegionInfo());
+    m_borderTiles.clear();
+    m_neighbours.clear();
+}
+
+void RegionGraph::scanBand(const Map& map, int bandIndex, int rowBegin, int rowEnd)
+{
+    Band& band = m_bands[bandIndex];
+    band.rowBegin = rowBegin;
+    band.rowEnd = rowEnd;
+    band.used = true;
+
+    const int width = map.getWidth();
+    const int regionCount = static_cast<int>(band.regions.size());
+
+    for (int y = rowBegin; y < rowEnd; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const MapTile* tile = map.getTile(x, y);
+            const int region = tile->getVoronoiRegion();
+            if (region < 0 || region >= regionCount)
+                continue;
+
+            // Stats
+            Accum& accum = band.regions[region];
+            if (accum.tileCount == 0)
+            {
+                accum.minX = accum.maxX = x;
+                accum.minY = accum.maxY = y;
+            }
+            else
+            {
+                // Rows come in order, so only x can move the min
+                accum.minX = std::min(accum.minX, x);
+                accum.maxX = std::max(accum.maxX, x);
+                accum.maxY = y;
+            }
+            ++accum.tileCount;
+            accum.sumX += x;
+            accum.sumY += y;
+
+            // Right and down edges, down stops at the band's last row (that's a seam)
+            const int index = y * width + x;
+            if (x + 1 < width)
+            {
+                const int right = map.getTile(x + 1, y)->getVoronoiRegion();
+                if (right >= 0 && right != region)
+                    addEdge(band, region, index, right, index + 1);
+            }
+            if (y + 1 < rowEnd)
+            {
+                const int down = map.getTile(x, y + 1)->getVoronoiRegion();
+                if (down >= 0 && down != region)
+                    addEdge(band, region, index, down, index + width);
+            }
+        }
+    }
+}
+
+void RegionGraph::finish(const Map& map)
+{
+    PROFILE_ZONE("RegionGraph::finish");
+
+    // Step 1: Seams, each band's last row against the row below it
+    const int width = map.getWidth();
+    const int height = map.getHeight();
+    for (const Band& band : m_bands)
+    {
+        if (!band.used || band.rowEnd >= height || band.rowEnd <= band.rowBegin)
+            continue;
+
+        const int y = band.rowEnd - 1;
+        for (int x = 0; x < width; ++x)
+        {
+            const int region = map.getTile(x, y)->getVoronoiRegion();
+            const int down = map.getTile(x, y + 1)->getVoronoiRegion();
+            if (region >= 0 && down >= 0 && down != region)
+                addEdge(m_seams, region, y * width + x, down, (y + 1) * width + x);
+        }
+    }
+
+    // Step 2: Merge into the tables
+    merge(map);
+}
+
+void RegionGraph::build(const Map& map, int regionCount)
+{
+    PROFILE_ZONE("RegionGraph::build");
+
+    begin(regionCount, 1);
+    scanBand(map, 0, 0, map.getHeight());
+    finish(map);
+}
+
+void RegionGraph::clear()
+{
+    m_regions.clear();
+    m_borderTiles.clear();
+    m_neighbours.clear();
+}
+
+void RegionGraph::addEdge(Band& band, int regionA, int tileA, int regionB, int tileB)
+{
+    band.edges.push_back(edgeKey(regionA, regionB));
+    band.borders.push_back((static_cast<std::uint64_t>(regionA) << 32) | static_cast<std::uint32_t>(tileA));
+    band.borders.push_back((static_cast<std::uint64_t>(regionB) << 32) | static_cast<std::uint32_t>(tileB));
+}
+
+void RegionGraph::merge(const Map& map)
+{
+    const int regionCount = static_cast<int>(m_regions.size());
+    const int width = std::max(map.getWidth(), 1);
+    const float tileSize = map.getTileSize();
+
+    // Step 1: Stats, summed over the bands
+    for (int region = 0; region < regionCount; ++region)
+    {
+        Accum total;
+        for (const Band& band : m_bands)
+        {
+            if (!band.used)
+                continue;
+
+            const Accum& accum = band.regions[region];
+            if (accum.tileCount == 0)
+                continue;
+
+            if (total.tileCount == 0)
+            {
+                total = accum;
+                continue;
+            }
+
+            total.tileCount += accum.tileCount;
+            total.minX = std::min(total.minX, accum.minX);
+            total.minY = std::min(total.minY, accum.minY);
+            total.maxX = std::max(total.maxX, accum.maxX);
+            total.maxY = std::max(total.maxY, accum.maxY);
+            total.sumX += accum.sumX;
+            total.sumY += accum.sumY;
+        }
+
+        RegionInfo& info = m_regions[region];
+        info.tileCount = total.tileCount;
+        if (total.tileCount == 0)
+            continue;
+
+        info.tileBounds = sf::IntRect(sf::Vector2i(total.minX, total.minY),
+            sf::Vector2i(total.maxX - total.minX + 1, total.maxY - total.minY + 1));
+
+        // Mean tile coordinate, then to the centre of that tile in world space
+        const double count = static_cast<double>(total.tileCount);
+        info.centroid = sf::Vector2f(
+            static_cast<float>((total.sumX / count + 0.5) * tileSize),
+            static_cast<float>((total.sumY / count + 0.5) * tileSize));
+    }
+
+    // Step 2: Border tiles, sorted groups them by region and drops the repeats
+    m_mergedBorders.clear();
+    for (const Band& band : m_bands)
+        m_mergedBorders.insert(m_mergedBorders.end(), band.borders.begin(), band.borders.end());
+    m_mergedBorders.insert(m_mergedBorders.end(), m_seams.borders.begin(), m_seams.borders.end());
+
+    std::sort(m_mergedBorders.begin(), m_mergedBorders.end());
+    m_mergedBorders.erase(std::unique(m_mergedBorders.begin(), m_mergedBorders.end()), m_mergedBorders.end());
+
+    m_borderTiles.reserve(m_mergedBorders.size());
+    for (std::uint64_t key : m_mergedBorders)
+    {
+        const int region = static_cast<int>(key >> 32);
+        const int tile = static_cast<int>(key & 0xFFFFFFFFu);
+
+        RegionInfo& info = m_regions[region];
+        if (info.borderCount == 0)
+            info.borderBegin = static_cast<int>(m_borderTiles.size());
+        ++info.borderCount;
+
+        m_borderTiles.emplace_back(tile % width, tile / width);
+    }
+
+    // Step 3: Adjacency, run length over the sorted edges gives one (low, high, length) per pair
+    m_mergedEdges.clear();
+    for (const Band& band : m_bands)
+        m_mergedEdges.insert(m_mergedEdges.end(), band.edges.begin(), band.edges.end());
+    m_mergedEdges.insert(m_mergedEdges.end(), m_seams.edges.begin(), m_seams.edges.end());
+
+    std::sort(m_mergedEdges.begin(), m_mergedEdges.end());
+
+    // Count first so each region gets its slice, then fill. Pairs come out ordered on low
+    // then high, which leaves every region's list sorted by neighbour id
+    auto forEachPair = [this](auto&& visit)
+    {
+        for (size_t i = 0; i < m_mergedEdges.size();)
+        {
+            const std::uint32_t key = m_mergedEdges[i];
+            size_t run = i;
+            while (run < m_mergedEdges.size() && m_mergedEdges[run] == key)
+                ++run;
+
+            visit(static_cast<int>(key >> 16), static_cast<int>(key & 0xFFFFu), static_cast<int>(run - i));
+            i = run;
+        }
+    };
+
+    forEachPair([this](int low, int high, int)
+    {
+            ++m_regions[low].neighbourCount;
+            ++m_regions[high].neighbourCount;
+    });
+
+    int offset = 0;
+    for (RegionInfo& info : m_regions)
+    {
+        info.neighbourBegin = offset;
+        offset += info.neighbourCount;
+        info.neighbourCount = 0;    // Reused as the fill cursor
+    }
+    m_neighbours.resize(offset);
+
+    forEachPair([this](int low, int high, int length)
+    {
+            RegionInfo& lowInfo = m_regions[low];
+            m_neighbours[lowInfo.neighbourBegin + lowInfo.neighbourCount++] = { high, length };
+
+            RegionInfo& highInfo = m_regions[high];
+            m_neighbours[highInfo.neighbourBegin + highInfo.neighbourCount++] = { low, length };
+    });
+}
+
+std::uint32_t RegionGraph::edgeKey(int a, int b)
+{
+    const std::uint32_t low = static_cast<std::uint32_t>(std::min(a, b));
+    const std::uint32_t high = static_cast<std::uint32_t>(std::max(a, b));
+    return (low << 16) | high;
+}
+
+// ========================================================================================================
+// QUERIES
+// ========================================================================================================
+const RegionGraph::RegionInfo* RegionGraph::getRegion(int regionId) const
+{
+    if (regionId < 0 || regionId >= static_cast<int>(m_regions.size()))
+        return nullptr;
+    return &m_regions[regionId];
+}
+
+RegionGraph::Range<sf::Vector2i> RegionGraph::getBorderTiles(int regionId) const
+{
+    const RegionInfo* info = getRegion(regionId);
+    if (!info || info->borderCount == 0)
+        return {};
+
+    const sf::Vector2i* first = m_borderTiles.data() + info->borderBegin;
+    return { first, first + info->borderCount };
+}
+
+RegionGraph::Range<RegionGraph::Neighbour> RegionGraph::getNeighbours(int regionId) const
+{
+    const RegionInfo* info = getRegion(regionId);
+    if (!info || info->neighbourCount == 0)
+        return {};
+
+    const Neighbour* first = m_neighbours.data() + info->neighbourBegin;
+    return { first, first + info->neighbourCount };
+}
+
+int RegionGraph::getSharedEdges(int regionA, int regionB) const
+{
+    // Neighbour lists are sorted by id
+    const Range<Neighbour> neighbours = getNeighbours(regionA);
+    const Neighbour* found = std::lower_bound(neighbours.begin(), neighbours.end(), regionB,
+        [](const Neighbour& neighbour, int id) { return neighbour.regionId < id; });
+
+    return (found != neighbours.end() && found->regionId == regionB) ? found->sharedEdges : 0;
+}
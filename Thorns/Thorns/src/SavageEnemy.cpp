@@ -2,6 +2,7 @@
 #include "LineOfSight.h"
 #include "MathUtilities.h"
 #include "AssetPaths.h"
+#include "Logger.h"
 #include <iostream>
 #include <cmath>
 
@@ -14,10 +15,10 @@ SavageEnemy::SavageEnemy()
 {
 }
 
-bool SavageEnemy::initialize(const std::string& atlasPath)
+bool SavageEnemy::initialize(const sf::Texture& atlas)
 {
     // First frame of the savage sprite sheet: 64x64 at origin
-    if (!m_sprite.loadTexture(atlasPath, 64.f, 64.f,
+    if (!m_sprite.setTexture(atlas, 64.f, 64.f,
         sf::IntRect(sf::Vector2i(0, 64), sf::Vector2i(64, 64))))
         return false;
 
@@ -52,7 +53,7 @@ void SavageEnemy::updateAI(const sf::Vector2f& playerPos, const Map* map)
         if (canSee)
         {
             m_aiState = AIState::Chase;
-            std::cout << "SavageEnemy: Chase\n";
+            LOG_DEBUG(AI, "SavageEnemy: Chase");
         }
         // Idle: no velocity
         m_velocity = sf::Vector2f(0.f, 0.f);
@@ -66,7 +67,7 @@ void SavageEnemy::updateAI(const sf::Vector2f& playerPos, const Map* map)
             // Player broke LOS, start lost timer
             m_aiState = AIState::Lost;
             m_lostTimer = 0.f;
-            std::cout << "SavageEnemy: Lost\n";
+            LOG_DEBUG(AI, "SavageEnemy: Lost");
             break;
         }
 
@@ -101,7 +102,7 @@ void SavageEnemy::updateAI(const sf::Vector2f& playerPos, const Map* map)
         {
             m_aiState = AIState::Idle;
             m_velocity = sf::Vector2f(0.f, 0.f);
-            std::cout << "SavageEnemy: Idle\n";
+            LOG_DEBUG(AI, "SavageEnemy: Idle");
             break;
         }
 
@@ -161,6 +162,6 @@ void SavageEnemy::takeDamage(float amount)
 {
     // Simple one-shot kill for now; expand with HealthComponent when ready
     m_active = false;
-    std::cout << "SavageEnemy killed\n";
+    LOG_INFO(AI, "SavageEnemy killed");
 }
 
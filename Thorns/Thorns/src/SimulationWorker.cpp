@@ -0,0 +1,79 @@
+#include "SimulationWorker.h"
+
+SimulationWorker::SimulationWorker()
+    : m_pending(false)
+    , m_busy(false)
+    , m_quit(false)
+{
+}
+
+SimulationWorker::~SimulationWorker()
+{
+    stop();
+}
+
+// ========== Lifetime ==========
+void SimulationWorker::start(std::function<void()> job)
+{
+    if (m_thread.joinable())
+        return;
+
+    m_job = std::move(job);
+    m_pending = false;
+    m_busy = false;
+    m_quit = false;
+    m_thread = std::thread(&SimulationWorker::threadMain, this);
+}
+
+void SimulationWorker::stop()
+{
+    if (!m_thread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_kickCondition.notify_one();
+    m_thread.join();
+}
+
+// ========== Per Frame ==========
+void SimulationWorker::kick()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending = true;
+    }
+    m_kickCondition.notify_one();
+}
+
+void SimulationWorker::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this]() { return !m_pending && !m_busy; });
+}
+
+void SimulationWorker::threadMain()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_kickCondition.wait(lock, [this]() { return m_pending || m_quit; });
+
+        if (m_quit)
+            break;
+
+        m_pending = false;
+        m_busy = true;
+
+        // Job runs unlocked, the main thread only touches the flags
+        lock.unlock();
+        m_job();
+        lock.lock();
+
+        m_busy = false;
+        m_doneCondition.notify_one();
+    }
+}
@@ -56,23 +56,7 @@ bool SpriteComponent::loadTexture(const std::string& texturePath, float width, f
     return true;
 }
 
-/// <summary>
-/// References external texture, so it doesn't own it.
-/// Had to be used for WorldObjects (as of writing), so all share 1 atlas for multiple different types of objects. 
-/// </summary>
-bool SpriteComponent::setSharedTexture(const sf::Texture& sharedTexture, float width, float height, const sf::IntRect& textureRect)
-{
-    // Set sprite to use external shared texture (no ownership)
-    m_sprite.setTexture(sharedTexture, true);
 
-    // Use specified region from atlas
-    m_textureRect = textureRect;
-    m_sprite.setTextureRect(m_textureRect);
-
-    setSize(width, height);
-    m_isValid = true;
-    return true;
-}
 
 void SpriteComponent::render(sf::RenderTarget& target) const
 {
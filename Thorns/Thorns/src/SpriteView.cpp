@@ -0,0 +1,118 @@
+#include "SpriteView.h"
+#include <cstdlib>
+
+SpriteView::SpriteView()
+    : m_texture(nullptr)
+    , m_textureRect(sf::Vector2i(0, 0), sf::Vector2i(0, 0))
+    , m_targetSize(0.0f, 0.0f)
+{
+}
+
+bool SpriteView::setTexture(const sf::Texture& texture, float width, float height, const sf::IntRect& textureRect)
+{
+    m_texture = &texture;
+    m_textureRect = textureRect;
+
+    setSize(width, height);
+    return true;
+}
+
+void SpriteView::render(sf::RenderTarget& target) const
+{
+    if (!m_texture)
+        return;
+
+    // Vertices come from the rect, the transform goes in through the render states
+    sf::Sprite sprite(*m_texture, m_textureRect);
+    target.draw(sprite, m_transform.getTransform());
+}
+
+sf::Sprite SpriteView::getSprite() const
+{
+    sf::Sprite sprite(*m_texture, m_textureRect);
+    sprite.setOrigin(m_transform.getOrigin());
+    sprite.setPosition(m_transform.getPosition());
+    sprite.setRotation(m_transform.getRotation());
+    sprite.setScale(m_transform.getScale());
+    return sprite;
+}
+
+void SpriteView::setPosition(const sf::Vector2f& pos)
+{
+    m_transform.setPosition(pos);
+}
+
+sf::Vector2f SpriteView::getPosition() const
+{
+    return m_transform.getPosition();
+}
+
+void SpriteView::setRotation(sf::Angle angle)
+{
+    m_transform.setRotation(angle);
+}
+
+sf::Angle SpriteView::getRotation() const
+{
+    return m_transform.getRotation();
+}
+
+void SpriteView::setOrigin(const sf::Vector2f& origin)
+{
+    m_transform.setOrigin(origin);
+}
+
+void SpriteView::centerOrigin()
+{
+    const sf::FloatRect bounds = getLocalBounds();
+    m_transform.setOrigin(sf::Vector2f(bounds.size.x / 2.0f, bounds.size.y / 2.0f));
+}
+
+void SpriteView::setSize(float width, float height)
+{
+    m_targetSize = sf::Vector2f(width, height);
+
+    if (m_textureRect.size.x == 0 || m_textureRect.size.y == 0) return;
+
+    float scaleX = width / static_cast<float>(m_textureRect.size.x);
+    float scaleY = height / static_cast<float>(m_textureRect.size.y);
+    m_transform.setScale(sf::Vector2f(scaleX, scaleY));
+}
+
+sf::Vector2f SpriteView::getSize() const
+{
+    const sf::Vector2f scale = m_transform.getScale();
+    return sf::Vector2f{ m_textureRect.size.x * scale.x, m_textureRect.size.y * scale.y };
+}
+
+void SpriteView::setScale(const sf::Vector2f& scale)
+{
+    m_transform.setScale(scale);
+}
+
+void SpriteView::move(const sf::Vector2f& offset)
+{
+    m_transform.move(offset);
+}
+
+void SpriteView::setTextureRect(const sf::IntRect& rect)
+{
+    m_textureRect = rect;
+
+    // Reapply the target size with the new texture rect
+    if (m_targetSize.x > 0 && m_targetSize.y > 0) {
+        setSize(m_targetSize.x, m_targetSize.y);
+    }
+}
+
+sf::FloatRect SpriteView::getBounds() const
+{
+    return m_transform.getTransform().transformRect(getLocalBounds());
+}
+
+sf::FloatRect SpriteView::getLocalBounds() const
+{
+    // Same as sf::Sprite, rect sized and anchored at 0,0 before the transform
+    return sf::FloatRect(sf::Vector2f(0.f, 0.f),
+        sf::Vector2f(static_cast<float>(std::abs(m_textureRect.size.x)), static_cast<float>(std::abs(m_textureRect.size.y))));
+}
@@ -4,14 +4,17 @@
 #include "MapTile.h"
 #include <iostream>
 #include "MathUtilities.h"
+#include "Logger.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
 
 // ========================================================================================================
 // SPATIAL GRID IMPLEMENTATION
 // ========================================================================================================
 
 SpatialGrid::SpatialGrid()
-    : m_cells(),
-    m_cellSize(0),
+    : m_cellSize(0),
     m_gridHeight(0),
     m_gridWidth(0),
     m_worldHeight(0)
@@ -28,27 +31,47 @@ void SpatialGrid::initialize(float worldWidth, float worldHeight, float cellSize
     m_gridWidth = static_cast<int>(std::ceil(worldWidth / cellSize));
     m_gridHeight = static_cast<int>(std::ceil(worldHeight / cellSize));
 
-    m_cells.clear();
+    // assign() keeps the capacity, a regeneration at the same size doesn't allocate
+    m_cellHeads.assign(static_cast<size_t>(m_gridWidth) * m_gridHeight, -1);
+    m_cellTails.assign(m_cellHeads.size(), -1);
+    m_siteNext.clear();
 
-    std::cout << "SpatialGrid initialized: " << m_gridWidth << " × " << m_gridHeight
-        << " cells (cell size: " << cellSize << "px)\n";
+    LOG_DEBUG(MapGen, "SpatialGrid initialized: %d x %d cells (cell size: %.1fpx)",
+        m_gridWidth, m_gridHeight, cellSize);
 }
 
 void SpatialGrid::clear()
 {
-    m_cells.clear();
+    std::fill(m_cellHeads.begin(), m_cellHeads.end(), -1);
+    std::fill(m_cellTails.begin(), m_cellTails.end(), -1);
+    m_siteNext.clear();
 }
 
 void SpatialGrid::addSite(int siteIndex, const sf::Vector2f& position)
 {
+    if (m_cellHeads.empty() || siteIndex < 0)
+        return;
+
+    if (static_cast<size_t>(siteIndex) >= m_siteNext.size())
+        m_siteNext.resize(siteIndex + 1, -1);
+    m_siteNext[siteIndex] = -1;
+
     sf::Vector2i gridPos = worldToGrid(position);
     int hash = gridToHash(gridPos.x, gridPos.y);
-    m_cells[hash].push_back(siteIndex);
+
+    if (m_cellTails[hash] < 0)
+        m_cellHeads[hash] = siteIndex;
+    else
+        m_siteNext[m_cellTails[hash]] = siteIndex;
+    m_cellTails[hash] = siteIndex;
 }
 
-std::vector<int> SpatialGrid::getNearbySites(const sf::Vector2f& position) const
+void SpatialGrid::getNearbySites(const sf::Vector2f& position, std::pmr::vector<int>& out) const
 {
-    std::vector<int> nearbySites;
+    out.clear();
+    if (m_cellHeads.empty())
+        return;
+
     sf::Vector2i gridPos = worldToGrid(position);
 
     // Check 3×3 neighborhood of cells
@@ -64,20 +87,12 @@ std::vector<int> SpatialGrid::getNearbySites(const sf::Vector2f& position) const
                 checkY < 0 || checkY >= m_gridHeight)
                 continue;
 
+            // Add all sites in this cell
             int hash = gridToHash(checkX, checkY);
-            auto it = m_cells.find(hash);
-
-            if (it != m_cells.end())
-            {
-                // Add all sites in this cell
-                nearbySites.insert(nearbySites.end(),
-                    it->second.begin(),
-                    it->second.end());
-            }
+            for (int site = m_cellHeads[hash]; site >= 0; site = m_siteNext[site])
+                out.push_back(site);
         }
     }
-
-    return nearbySites;
 }
 
 sf::Vector2i SpatialGrid::worldToGrid(const sf::Vector2f& position) const
@@ -112,168 +127,54 @@ void VoronoiDiagram::generateSitesPoisson(Map* map, unsigned char numSites,
     float minSiteDistance, std::mt19937& rng)
 {
     // Step 1: Clear old data from previous generation
-    std::cout << "Generating Voronoi sites with Poisson disk sampling...\n";
+    LOG_DEBUG(MapGen, "Generating Voronoi sites with Poisson disk sampling...");
     m_sites.clear();
-    m_poissonGrid.clear();
-    m_activeList.clear();
 
-    // Bridson's Poisson Disk Sampling Algorithm
+    // Bridson's Poisson Disk Sampling Algorithm, lives in PoissonSampler now
     // Reference: https://www.cs.ubc.ca/~rbridson/docs/bridson-siggraph07-poissondisk.pdf
     // Video: https://www.youtube.com/watch?v=7WcmyxyFO7o (In unity but for example)
 
     //Step 2: Set up 
-    sf::Vector2f worldSize = map->getWorldSize();
-    const float hideoutExclusion = 400.f;
-    const int k = 30; // Number of attempts per active point
-
-    // Step 3:
-    // Cell size for background grid (r / sqrt(2) ensures no two points in same cell)
-    float cellSize = minSiteDistance / std::sqrt(2.f);
-
-    // Ensure there are enough cells to cover the world map
-    int gridWidth = static_cast<int>(std::ceil(worldSize.x / cellSize));
-    int gridHeight = static_cast<int>(std::ceil(worldSize.y / cellSize));
-
-    // Step 4:
-    // Background grid for O(1) collision detection
-    m_poissonGrid.resize(gridWidth * gridHeight, sf::Vector2f(-1.f, -1.f)); // -1 = empty
-
-
-
-    // Distributions
-    std::uniform_real_distribution<float> distX(0.f, worldSize.x);
-    std::uniform_real_distribution<float> distY(0.f, worldSize.y);
-    std::uniform_real_distribution<float> distRadius(minSiteDistance, 2.f * minSiteDistance);
-    std::uniform_real_distribution<float> distAngle(0.f, MathUtils::TWO_PI);
-
-    // Step 6: Choose initial sample (avoid hideout)
-    sf::Vector2f initialSample;
-    int attempts = 0;
-    do
-    {
-        initialSample = sf::Vector2f(distX(rng), distY(rng));
-        ++attempts;
-    } while (!isValidSitePositionPoisson(initialSample, hideoutPos, minSiteDistance, hideoutExclusion)
-        && attempts < 1000);
-
-    if (attempts >= 1000)
+    const sf::Vector2f worldSize = map->getWorldSize();
+    const float hideoutExclusion = HIDEOUT_EXCLUSION;
+
+    PoissonSampler::Params params;
+    params.bounds = sf::FloatRect(sf::Vector2f(0.f, 0.f), worldSize);
+    params.minRadius = minSiteDistance;
+    params.maxRadius = minSiteDistance;
+    params.attemptsPerPoint = 30;
+    params.maxPoints = numSites;
+
+    // Step 3: Keep sites away from the hideout
+    m_sampler.clearExclusions();
+    m_sampler.addExclusionCircle(hideoutPos, hideoutExclusion);
+
+    // Points and sampler grid only live for this call, the generator's arena takes them back
+    PoissonSampler::PointList samplePoints(m_scratch ? m_scratch : std::pmr::get_default_resource());
+    if (m_sampler.sample(params, rng, samplePoints) == 0)
     {
         std::cerr << "Failed to find initial Poisson sample\n";
         return;
     }
 
-    // Step 7: Add initial sample
-    m_activeList.push_back(initialSample);
-    int gridX = static_cast<int>(initialSample.x / cellSize);
-    int gridY = static_cast<int>(initialSample.y / cellSize);
-    m_poissonGrid[gridY * gridWidth + gridX] = initialSample;
-
-
-    // Make site from inital sampling
-    sf::Vector2i tileCoords = map->worldToTile(initialSample);
-    sf::Vector2f snappedPos = map->tileToWorld(tileCoords.x, tileCoords.y);
-    m_sites.emplace_back(snappedPos, tileCoords, static_cast<int>(m_sites.size()));
-
-    // Step 8: Generate points from active list
-    while (!m_activeList.empty() && m_sites.size() < size_t(numSites))
+    // Step 4: Make sites from the samples, snapped to their tile centres
+    m_sites.reserve(samplePoints.size());
+    for (const sf::Vector2f& point : samplePoints)
     {
-        // Step 8.1: Pick random point from active list
-        std::uniform_int_distribution<size_t> activeDist(0, m_activeList.size() - 1);
-        size_t activeIndex = activeDist(rng);
-        sf::Vector2f activePoint = m_activeList[activeIndex];
-
-        bool foundValidPoint = false;
-
-        // Step 8.2: Try k times to place a point in the annulus (ring shape)
-        // Annulus = area between radius r and 2r from active point
-        for (int attempt = 0; attempt < k; ++attempt)
-        {
-            // Generate point in annulus
-            float radius = distRadius(rng); // from the current active point
-            float angle = distAngle(rng);
-
-            sf::Vector2f direction = MathUtils::angleRadiansToVector(angle); // No impact on time generation, roughly the same, keeping for readability
-            sf::Vector2f candidate = activePoint + (direction * radius);
-
-            // Step 8.3: Check bounds
-            if (candidate.x < 0 || candidate.x >= worldSize.x ||
-                candidate.y < 0 || candidate.y >= worldSize.y)
-                continue;
-
-            // Step 8.4: Check if valid using grid
-            int candGridX = static_cast<int>(candidate.x / cellSize);
-            int candGridY = static_cast<int>(candidate.y / cellSize);
-
-            bool tooClose = false;
-
-            // Check 5×5 neighborhood (conservative)
-            for (int dy = -2; dy <= 2 && !tooClose; ++dy)
-            {
-                for (int dx = -2; dx <= 2 && !tooClose; ++dx)
-                {
-                    int checkX = candGridX + dx;
-                    int checkY = candGridY + dy;
-
-                    if (checkX < 0 || checkX >= gridWidth ||
-                        checkY < 0 || checkY >= gridHeight)
-                        continue;
-
-                    sf::Vector2f neighbor = m_poissonGrid[checkY * gridWidth + checkX];
-
-                    // Check if cell is occupied
-                    if (neighbor.x >= 0.f)
-                    {
-                        float distSq = distanceSquared(candidate, neighbor);
-                        if (distSq < minSiteDistance * minSiteDistance)
-                        {
-                            tooClose = true;
-                            break;
-                        }
-                    }
-                }
-            }
-
-            if (tooClose)
-                continue;
-
-            // Step 8.5: Check hideout exclusion
-            if (!isValidSitePositionPoisson(candidate, hideoutPos, minSiteDistance, hideoutExclusion))
-                continue;
-
-            // Valid point found
-            m_activeList.push_back(candidate);
-            m_poissonGrid[candGridY * gridWidth + candGridX] = candidate;
-
-            // Create site
-            sf::Vector2i tileCoords = map->worldToTile(candidate);
-            sf::Vector2f snappedPos = map->tileToWorld(tileCoords.x, tileCoords.y);
-            m_sites.emplace_back(snappedPos, tileCoords, static_cast<int>(m_sites.size()));
-
-            foundValidPoint = true;
-            break;
-        }
-
-        // Step 8.6: If no valid point found after k attempts, remove from active list
-        // Had to add to prevent infin loops
-        if (!foundValidPoint)
-        {
-            m_activeList.erase(m_activeList.begin() + activeIndex);
-        }
-
+        sf::Vector2i tileCoords = map->worldToTile(point);
+        sf::Vector2f snappedPos = map->tileToWorld(tileCoords.x, tileCoords.y);
+        m_sites.emplace_back(snappedPos, tileCoords, static_cast<int>(m_sites.size()));
     }
 
     // PN: Just to check if the num sites wanted to generated actually generated 
     if (m_sites.size() < static_cast<size_t>(numSites))
     {
-        std::cout << "WARNING: Only generated " << m_sites.size() << " sites out of "
-            << static_cast<int>(numSites) << " requested\n";
-        std::cout << "  This may be due to:\n";
-        std::cout << "    - minSiteDistance (" << minSiteDistance << "px) too large for map\n";
-        std::cout << "    - Hideout exclusion zone limiting placement\n";
-        std::cout << "    - Or some other issue in the poisson sampling\n";
+        LOG_WARN(MapGen, "Only generated %zu sites out of %d requested. minSiteDistance (%.1fpx) "
+            "may be too large for the map, or the hideout exclusion zone is limiting placement",
+            m_sites.size(), static_cast<int>(numSites), minSiteDistance);
     }
 
-    std::cout << "Poisson disk sampling complete: " << m_sites.size() << " sites generated\n";
+    LOG_DEBUG(MapGen, "Poisson disk sampling complete: %zu sites generated", m_sites.size());
 }
 
 // PN: NOT BEING USED, ONLY FOR DOCS
@@ -282,11 +183,11 @@ void VoronoiDiagram::generateSitesRejection(Map* map, unsigned char numSites,
     float minSiteDistance, std::mt19937& rng)
 {
 
-    std::cout << "Generating Voronoi sites with Rejection sampling...\n";
+    LOG_DEBUG(MapGen, "Generating Voronoi sites with Rejection sampling...");
     m_sites.clear();
 
     sf::Vector2f worldSize = map->getWorldSize();
-    const float hideoutExclusion = 400.f;
+    const float hideoutExclusion = HIDEOUT_EXCLUSION;
 
     std::uniform_real_distribution<float> distX(0.f, worldSize.x);
     std::uniform_real_distribution<float> distY(0.f, worldSize.y);
@@ -294,8 +195,7 @@ void VoronoiDiagram::generateSitesRejection(Map* map, unsigned char numSites,
     int attempts = 0;
     const int maxAttempts = numSites * 1000; // Max 1000 tries per site
 
-    std::cout << "Generating " << static_cast<int>(numSites)
-        << " sites using rejection sampling...\n";
+    LOG_DEBUG(MapGen, "Generating %d sites using rejection sampling...", static_cast<int>(numSites));
 
     while (m_sites.size() < static_cast<size_t>(numSites) && attempts < maxAttempts)
     {
@@ -344,27 +244,22 @@ void VoronoiDiagram::generateSitesRejection(Map* map, unsigned char numSites,
     }
     else
     {
-        std::cout << "Rejection sampling complete: " << m_sites.size()
-            << " sites placed in " << attempts << " attempts\n";
+        LOG_DEBUG(MapGen, "Rejection sampling complete: %zu sites placed in %d attempts",
+            m_sites.size(), attempts);
     }
 }
 
-bool VoronoiDiagram::isValidSitePositionPoisson(const sf::Vector2f& pos,
-    const sf::Vector2f& hideoutPos,
-    float minDist, float hideoutExclusion) const
-{
-    // Check distance from hideout
-    float distToHideout = std::sqrt(distanceSquared(pos, hideoutPos));
-    return distToHideout >= hideoutExclusion;
-}
-
 void VoronoiDiagram::assignTilesToRegionsSP(Map* map)
 {
     int width = map->getWidth();
     int height = map->getHeight();
     int tilesProcessed = 0;
 
-    std::cout << "Assigning " << (width * height) << " tiles to Voronoi regions...\n";
+    LOG_DEBUG(MapGen, "Assigning %d tiles to Voronoi regions...", width * height);
+
+    // One lookup buffer for the whole pass
+    std::pmr::vector<int> nearbySiteIndices(m_scratch ? m_scratch : std::pmr::get_default_resource());
+    nearbySiteIndices.reserve(m_sites.size());
 
     // For each tile, find nearest site using spatial grid
     for (int y = 0; y < height; ++y)
@@ -383,7 +278,7 @@ void VoronoiDiagram::assignTilesToRegionsSP(Map* map)
             sf::Vector2f tilePos = map->tileToWorld(x, y);
 
             // Get nearby sites from spatial grid (O(k) instead of O(s))
-            std::vector<int> nearbySiteIndices = m_spatialGrid.getNearbySites(tilePos);
+            m_spatialGrid.getNearbySites(tilePos, nearbySiteIndices);
 
             if (nearbySiteIndices.empty())
             {
@@ -415,7 +310,7 @@ void VoronoiDiagram::assignTilesToRegionsSP(Map* map)
         }
     }
 
-    std::cout << "Tile assignment complete: " << tilesProcessed << " tiles assigned\n";
+    LOG_DEBUG(MapGen, "Tile assignment complete: %d tiles assigned", tilesProcessed);
 }
 
 bool VoronoiDiagram::isValidSitePosition(const sf::Vector2f& pos, const sf::Vector2f& hideoutPos,
@@ -442,6 +337,59 @@ void VoronoiDiagram::markSiteWithPOI(int siteID)
 
 }
 
+void VoronoiDiagram::restoreSites(std::vector<VoronoiSite>&& sites, float worldWidth, float worldHeight, float cellSize)
+{
+    clear();
+    m_sites = std::move(sites);
+
+    m_spatialGrid.initialize(worldWidth, worldHeight, cellSize);
+    for (size_t i = 0; i < m_sites.size(); ++i)
+    {
+        m_spatialGrid.addSite(static_cast<int>(i), m_sites[i].position);
+    }
+}
+
+float VoronoiDiagram::relaxSites(const Map& map, const std::pmr::vector<sf::Vector2f>& targets,
+    const sf::Vector2f& hideoutPos, float cellSize, std::pmr::vector<float>& displacement)
+{
+    displacement.assign(m_sites.size(), 0.f);
+    float maxDisplacement = 0.f;
+
+    for (size_t i = 0; i < m_sites.size() && i < targets.size(); ++i)
+    {
+        VoronoiSite& site = m_sites[i];
+
+        // Same snapping as generation, sites always sit on a tile centre
+        const sf::Vector2i tileCoords = map.worldToTile(targets[i]);
+        const MapTile* tile = map.getTile(tileCoords.x, tileCoords.y);
+        if (!tile || tileCoords == site.tileCoords)
+            continue;
+
+        // Centroid of a region wrapped around a POI can land inside it, the site stays put
+        const sf::Vector2f snappedPos = map.tileToWorld(tileCoords.x, tileCoords.y);
+        if (tile->getTerrainType() == MapTile::TerrainType::POI_Collision
+            || distanceSquared(snappedPos, hideoutPos) < HIDEOUT_EXCLUSION * HIDEOUT_EXCLUSION)
+            continue;
+
+        displacement[i] = std::sqrt(distanceSquared(site.position, snappedPos));
+        maxDisplacement = std::max(maxDisplacement, displacement[i]);
+
+        site.position = snappedPos;
+        site.tileCoords = tileCoords;
+    }
+
+    // Grid cells hold positions, so moved sites need it rebuilt
+    if (maxDisplacement > 0.f)
+    {
+        const sf::Vector2f worldSize = map.getWorldSize();
+        m_spatialGrid.initialize(worldSize.x, worldSize.y, cellSize);
+        for (size_t i = 0; i < m_sites.size(); ++i)
+            m_spatialGrid.addSite(static_cast<int>(i), m_sites[i].position);
+    }
+
+    return maxDisplacement;
+}
+
 int VoronoiDiagram::getClosestSiteId(const sf::Vector2f& worldPos) const
 {
     if (m_sites.empty())
@@ -474,16 +422,49 @@ float VoronoiDiagram::distanceSquared(const sf::Vector2f& a, const sf::Vector2f&
 
 void VoronoiDiagram::renderDebug(sf::RenderTarget& target) const
 {
-    // Draw sites as circles
-    for (const auto& site : m_sites)
+    if (m_debugMarkers.getVertexCount() > 0)
+        target.draw(m_debugMarkers);
+}
+
+void VoronoiDiagram::buildDebugGeometry()
+{
+    // Same look as the old per frame CircleShape: filled disc in the site colour, white outline
+    // outside it. Unit circle is worked out once and scaled per site
+    std::array<sf::Vector2f, MARKER_SEGMENTS + 1> unitCircle;
+    for (int i = 0; i <= MARKER_SEGMENTS; ++i)
     {
-        sf::CircleShape circle(8.f);
-        circle.setOrigin(sf::Vector2f(8.f, 8.f));
-        circle.setPosition(site.position);
-        circle.setFillColor(site.debugColor);
-        circle.setOutlineColor(sf::Color::White);
-        circle.setOutlineThickness(2.f);
-        target.draw(circle);
+        const float angle = (static_cast<float>(i % MARKER_SEGMENTS) / MARKER_SEGMENTS) * MathUtils::TWO_PI;
+        unitCircle[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+    }
+
+    constexpr size_t VERTICES_PER_SITE = MARKER_SEGMENTS * 3 + MARKER_SEGMENTS * 6;
+    m_debugMarkers.resize(m_sites.size() * VERTICES_PER_SITE);
+
+    const float outerRadius = MARKER_RADIUS + MARKER_OUTLINE;
+    size_t v = 0;
+    for (const VoronoiSite& site : m_sites)
+    {
+        const sf::Vector2f centre = site.position;
+        for (int i = 0; i < MARKER_SEGMENTS; ++i)
+        {
+            const sf::Vector2f innerA = centre + unitCircle[i] * MARKER_RADIUS;
+            const sf::Vector2f innerB = centre + unitCircle[i + 1] * MARKER_RADIUS;
+            const sf::Vector2f outerA = centre + unitCircle[i] * outerRadius;
+            const sf::Vector2f outerB = centre + unitCircle[i + 1] * outerRadius;
+
+            // Fill wedge
+            m_debugMarkers[v++] = sf::Vertex{ centre, site.debugColor, {} };
+            m_debugMarkers[v++] = sf::Vertex{ innerA, site.debugColor, {} };
+            m_debugMarkers[v++] = sf::Vertex{ innerB, site.debugColor, {} };
+
+            // Outline quad
+            m_debugMarkers[v++] = sf::Vertex{ innerA, sf::Color::White, {} };
+            m_debugMarkers[v++] = sf::Vertex{ outerA, sf::Color::White, {} };
+            m_debugMarkers[v++] = sf::Vertex{ innerB, sf::Color::White, {} };
+            m_debugMarkers[v++] = sf::Vertex{ innerB, sf::Color::White, {} };
+            m_debugMarkers[v++] = sf::Vertex{ outerA, sf::Color::White, {} };
+            m_debugMarkers[v++] = sf::Vertex{ outerB, sf::Color::White, {} };
+        }
     }
 }
 
@@ -26,12 +26,12 @@ bool WorldItem::activate(ItemType type, const sf::Vector2f& worldPos,
     m_pickupRadius = data->pickupRadius;
 
 
-    if (!m_sprite.setSharedTexture(sharedAtlas,
+    if (!m_sprite.setTexture(sharedAtlas,
         data->spriteSize.x,
         data->spriteSize.y,
         data->atlasRect))
     {
-        std::cerr << "WorldItem::activate: setSharedTexture failed for type "
+        std::cerr << "WorldItem::activate: setTexture failed for type "
             << static_cast<int>(type) << "\n";
         return false;
     }
@@ -86,6 +86,27 @@ void WorldItemPool::render(sf::RenderTarget& target, const sf::View& view) const
     }
 }
 
+void WorldItemPool::captureSprites(std::vector<sf::Sprite>& out, const sf::View& view) const
+{
+    const sf::Vector2f centre = view.getCenter();
+    const sf::Vector2f size = view.getSize();
+    const sf::FloatRect viewBounds(
+        sf::Vector2f(centre.x - size.x * 0.5f, centre.y - size.y * 0.5f),
+        size
+    );
+
+    for (const auto& item : m_pool)
+    {
+        if (!item.isActive() || !item.getSpriteView().isValid())
+            continue;
+
+        if (!viewBounds.findIntersection(item.getBounds()).has_value())
+            continue;
+
+        out.push_back(item.getSpriteView().getSprite());
+    }
+}
+
 std::vector<WorldItem*> WorldItemPool::getActiveItems()
 {
     std::vector<WorldItem*> active;
@@ -109,4 +130,4 @@ int WorldItemPool::getActiveCount() const
             ++count;
     }
     return count;
-}
\ No newline at end of file
+}
\ No newline at end of file
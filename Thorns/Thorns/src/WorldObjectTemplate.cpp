@@ -1,6 +1,11 @@
 #include "WorldObjectTemplate.h"
 #include <tmxlite/ObjectGroup.hpp>
+#include <algorithm>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include "CollisionTemplateCache.h"
+#include "Logger.h"
 
 WorldObjectTemplateManager::WorldObjectTemplateManager()
 {
@@ -8,6 +13,30 @@ WorldObjectTemplateManager::WorldObjectTemplateManager()
 
 bool WorldObjectTemplateManager::loadTemplates(const std::string& tmxPath)
 {
+    // Binary cache first. Groups are keyed by TMX object name and go through nameToType like the
+    // XML does, so reordering WorldObject::Type can't hand a cached shape to the wrong type
+    std::vector<CollisionTemplateCache::Group> cached;
+    if (CollisionTemplateCache::load(tmxPath, cached))
+    {
+        m_shapes.clear();
+        for (auto& group : cached)
+        {
+            WorldObject::Type type;
+            if (!nameToType(group.name, type))
+            {
+                LOG_WARN(Objects, "WorldObjectCollisionLoader: Unknown cached object name '%s', skipping",
+                    group.name.c_str());
+                continue;
+            }
+
+            std::vector<CollisionShape>& shapes = m_shapes[type];
+            shapes.insert(shapes.end(), group.shapes.begin(), group.shapes.end());
+        }
+
+        LOG_DEBUG(Objects, "WorldObjectTemplateManager: %zu types loaded from cache", m_shapes.size());
+        return !m_shapes.empty();
+    }
+
     tmx::Map mapData;
     if (!mapData.load(tmxPath))
     {
@@ -17,6 +46,9 @@ bool WorldObjectTemplateManager::loadTemplates(const std::string& tmxPath)
 
     m_shapes.clear();
 
+    // Same shapes grouped by TMX object name for the cache, in file order
+    std::vector<CollisionTemplateCache::Group> groups;
+
     for (const auto& layer : mapData.getLayers())
     {
         if (layer->getType() != tmx::Layer::Type::Object) continue;
@@ -29,8 +61,8 @@ bool WorldObjectTemplateManager::loadTemplates(const std::string& tmxPath)
             WorldObject::Type type;
             if (!nameToType(obj.getName(), type))
             {
-                std::cout << "WorldObjectCollisionLoader: Unknown object name '"
-                    << obj.getName() << "', skipping.\n";
+                LOG_WARN(Objects, "WorldObjectCollisionLoader: Unknown object name '%s', skipping",
+                    obj.getName().c_str());
                 continue;
             }
 
@@ -38,6 +70,17 @@ bool WorldObjectTemplateManager::loadTemplates(const std::string& tmxPath)
             if (!buildShape(obj, shape))
                 continue;
 
+            auto group = std::find_if(groups.begin(), groups.end(),
+                [&](const CollisionTemplateCache::Group& g) { return g.name == obj.getName(); });
+            if (group == groups.end())
+            {
+                groups.emplace_back();
+                group = groups.end() - 1;
+                group->name = obj.getName();
+                group->id = -1;     // Unused, the name is the key
+            }
+            group->shapes.push_back(shape);
+
             // Append to the type's shape list (one TMX object = one shape)
             m_shapes[type].push_back(std::move(shape));
         }
@@ -45,24 +88,48 @@ bool WorldObjectTemplateManager::loadTemplates(const std::string& tmxPath)
 
     for (const auto& [type, shapes] : m_shapes)
     {
-        std::cout << "WorldObjectCollisionLoader: Type " << static_cast<int>(type)
-            << " -> " << shapes.size() << " collision shape(s)\n";
+        LOG_DEBUG(Objects, "WorldObjectCollisionLoader: Type %d -> %zu collision shape(s)",
+            static_cast<int>(type), shapes.size());
     }
 
+    // Write the cache for next time. A name the record would truncate couldn't be resolved on
+    // load, so those files just keep parsing the XML
+    const bool namesFit = std::all_of(groups.begin(), groups.end(), [](const CollisionTemplateCache::Group& g)
+        {
+            return g.name.size() < sizeof(CollisionTemplateCache::GroupRecord::name);
+        });
+    if (!groups.empty() && namesFit)
+        CollisionTemplateCache::save(tmxPath, groups);
+
     return !m_shapes.empty();
 }
 
+std::shared_ptr<const WorldObjectTemplateManager> WorldObjectTemplateManager::loadShared(const std::string& tmxPath)
+{
+    // Weak so the shapes go away with the last placer, the lock covers the cache file write too
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::weak_ptr<const WorldObjectTemplateManager>> loaded;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto existing = loaded[tmxPath].lock())
+        return existing;
+
+    auto manager = std::make_shared<WorldObjectTemplateManager>();
+    if (!manager->loadTemplates(tmxPath))
+        return nullptr;
+
+    loaded[tmxPath] = manager;
+    return manager;
+}
+
 const std::vector<CollisionShape>* WorldObjectTemplateManager::getShapes(WorldObject::Type type) const
 {
-    auto it = m_shapes.find(type);
-    if (it != m_shapes.end())
-        return &it->second;
-    return nullptr;
+    return m_shapes.find(type);
 }
 
 bool WorldObjectTemplateManager::hasShapes(WorldObject::Type type) const
 {
-    return m_shapes.count(type) > 0;
+    return m_shapes.contains(type);
 }
 
 bool WorldObjectTemplateManager::nameToType(const std::string& name, WorldObject::Type& outType)
@@ -122,6 +189,7 @@ bool WorldObjectTemplateManager::buildShape(const tmx::Object& obj, CollisionSha
         if (poly.points.size() < 3)
             return false;
 
+        poly.computeBounds();
         outShape = std::move(poly);
         return true;
     }
@@ -15,13 +15,116 @@
 #endif 
 
 #include <iostream>
+#include <cstdlib>
+#include <string>
 #include "Game.h"
+#include "Logger.h"
+#include "JobSystem.h"
 
+// Command line (all optional):
+//   --headless [ticks]   run the update loop with no window and report ticks/s
+//   --seed N             map seed
+//   --map-size N         map width and height in tiles
+//   --record FILE        record per tick input to FILE
+//   --replay FILE        play input back from FILE (seed and map size come from the file)
+//   --fps N              render frame cap, 0 = uncapped
+//   --vsync              enable vsync
+//   --no-interp          draw the last tick as-is instead of blending between ticks
+//   --threaded-sim       step the simulation on a worker thread while the last frame draws
+//   --load-map FILE      restore the map from a snapshot instead of generating it
+//   --save-map FILE      write the generated map to a snapshot
+//   --no-map-cache       always generate, never read or write cache/maps
+static Game::LaunchOptions parseLaunchOptions(int argc, char* argv[])
+{
+	Game::LaunchOptions options;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		const bool hasValue = (i + 1 < argc);
+
+		if (arg == "--headless")
+		{
+			options.headless = true;
+
+			// Tick count is optional
+			if (hasValue && argv[i + 1][0] != '-')
+				options.headlessTicks = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (arg == "--seed" && hasValue)
+		{
+			options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (arg == "--map-size" && hasValue)
+		{
+			unsigned long size = std::strtoul(argv[++i], nullptr, 10);
+			options.mapWidth = static_cast<unsigned short>(size);
+			options.mapHeight = static_cast<unsigned short>(size);
+		}
+		else if (arg == "--record" && hasValue)
+		{
+			options.recordPath = argv[++i];
+		}
+		else if (arg == "--replay" && hasValue)
+		{
+			options.replayPath = argv[++i];
+		}
+		else if (arg == "--fps" && hasValue)
+		{
+			options.targetFps = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (arg == "--vsync")
+		{
+			options.vsync = true;
+		}
+		else if (arg == "--no-interp")
+		{
+			options.interpolate = false;
+		}
+		else if (arg == "--threaded-sim")
+		{
+			options.threadedSim = true;
+		}
+		else if (arg == "--load-map" && hasValue)
+		{
+			options.loadMapPath = argv[++i];
+		}
+		else if (arg == "--save-map" && hasValue)
+		{
+			options.saveMapPath = argv[++i];
+		}
+		else if (arg == "--no-map-cache")
+		{
+			options.mapCache = false;
+		}
+		else
+		{
+			std::cerr << "Unknown or incomplete argument: " << arg << "\n";
+		}
+	}
+
+	return options;
+}
 
-int main()
+int main(int argc, char* argv[])
 {
-	Game game;
-	game.run();
+	const Game::LaunchOptions options = parseLaunchOptions(argc, argv);
+
+	// Start the log drain thread before anything else can write to it.
+	// Headless keeps the console for the tick report only
+	Logger::initialize("thorns.log", !options.headless);
+
+	// Workers for generation, AI and collision jobs, one less than the core count
+	JobSystem::initialize();
+
+	{
+		Game game(options);
+		game.run();
+	}
+
+	// Game is destroyed first so its shutdown messages still make it into the file
+	JobSystem::shutdown();
+	Logger::shutdown();
 
 	return EXIT_SUCCESS;
 }
\ No newline at end of file